@@ -5,12 +5,18 @@
 
 #include "export_definitions.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <future>
+#include <map>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace sokketter {
@@ -31,12 +37,14 @@ namespace sokketter {
     /**
      * @brief path to the folder where all related files are stored.
      * @return std::filesystem::path.
+     * @attention the folder is created when the first file is saved into it.
      */
     auto EXPORTED storage_path() -> std::filesystem::path;
 
     /**
      * @brief path to the folder where all logs are stored.
      * @return std::filesystem::path.
+     * @attention the folder is created by the first log file written into it.
      */
     auto EXPORTED logs_path() -> std::filesystem::path;
 
@@ -66,6 +74,93 @@ namespace sokketter {
         std::string message = "";
     };
 
+    /**
+     * @brief allocation-free variant of callback_response_structure.
+     * @attention message, file and function are only valid for the duration of the callback.
+     */
+    struct EXPORTED callback_view_structure
+    {
+        sokketter::logging_level level = sokketter::logging_level::ERR;
+        const char *file = nullptr;
+        int line = 0;
+        const char *function = nullptr;
+        std::string_view message = {};
+    };
+
+    /**
+     * @brief states how log messages are delivered to the logging callback.
+     */
+    enum class logging_mode : uint8_t
+    {
+        /**
+         * @brief callback is called on the thread that logged the message.
+         */
+        SYNCHRONOUS = 0,
+
+        /**
+         * @brief messages are queued and the callback is called from a background thread.
+         * @attention messages are dropped while the queue is full and longer messages are
+         * truncated, the number of dropped messages is reported once the queue drains.
+         */
+        ASYNCHRONOUS = 1
+    };
+
+    /**
+     * @brief states when socket states are served from memory instead of the power strip.
+     */
+    enum class socket_state_cache_mode : uint8_t
+    {
+        /**
+         * @brief every status read queries the power strip.
+         */
+        ALWAYS_READ = 0,
+
+        /**
+         * @brief states read or switched within settings_structure::socket_state_cache_ttl_msec
+         * are served from memory.
+         */
+        TIME_TO_LIVE = 1,
+
+        /**
+         * @brief states are read once and then follow the successful switches.
+         * @attention switching by other clients or by the buttons of the power strip is only seen
+         * after power_strip::invalidate_socket_states().
+         */
+        TRUST_LAST_WRITE = 2,
+
+        /**
+         * @brief states younger than the TTL are served from memory, older ones are returned
+         * immediately while they are read again in the background.
+         */
+        STALE_WHILE_REVALIDATE = 3
+    };
+
+    /**
+     * @brief states how failed transfers to power strips over one transport are retried.
+     */
+    struct EXPORTED retry_policy
+    {
+        /**
+         * @brief number of attempts including the first one.
+         * @attention 1 disables retrying.
+         */
+        uint32_t max_attempts = 3;
+
+        /**
+         * @brief time in milliseconds waited after the first failed attempt, multiplied by
+         * backoff_multiplier after each further one.
+         */
+        uint32_t initial_backoff_msec = 50;
+        double backoff_multiplier = 2.0;
+        uint32_t max_backoff_msec = 1000;
+
+        /**
+         * @brief share of the waiting time randomized in both directions.
+         * @attention 0 disables the jitter.
+         */
+        double jitter = 0.2;
+    };
+
     /**
      * @brief
      */
@@ -73,7 +168,95 @@ namespace sokketter {
     {
         sokketter::logging_level logging_level = sokketter::logging_level::ERR;
         std::function<void(callback_response_structure)> logging_callback = nullptr;
+
+        /**
+         * @brief allocation-free logging callback, used instead of logging_callback when set.
+         */
+        std::function<void(const callback_view_structure &)> logging_view_callback = nullptr;
+
         std::string logging_pattern = "%+";
+
+        sokketter::logging_mode logging_mode = sokketter::logging_mode::SYNCHRONOUS;
+
+        /**
+         * @brief maximum number of queued messages in asynchronous mode.
+         */
+        size_t logging_queue_size = 1024;
+
+        /**
+         * @brief minimum number of seconds between two background update checks.
+         * @attention 0 checks on every check_for_update_async() call.
+         */
+        uint32_t update_check_interval_sec = 24 * 60 * 60;
+
+        /**
+         * @brief IPv4 subnets in CIDR notation searched for Ethernet power strips, e.g.
+         *        "192.168.0.0/24".
+         * @attention known addresses and network neighbours with the Energenie MAC prefix are
+         *            always probed first, the subnets are an optional fallback only swept when a
+         *            known power strip is missing or nothing was found.
+         *            Hosts behind a router are recognized by the page of the power strip, which
+         *            must show its MAC address unless the power strip is already stored.
+         *            When empty, kommpot keeps scanning for the power strips the neighbour
+         *            probe did not find, and without a readable neighbour table the Ethernet
+         *            discovery is left to kommpot alone.
+         */
+        std::vector<std::string> ethernet_discovery_subnets = {};
+
+        /**
+         * @brief maximum number of hosts probed at the same time during the Ethernet discovery.
+         */
+        size_t ethernet_discovery_concurrency = 64;
+
+        /**
+         * @brief time in milliseconds given to each probed host to accept the connection.
+         */
+        uint32_t ethernet_discovery_timeout_msec = 500;
+
+        sokketter::socket_state_cache_mode socket_state_cache_mode =
+            sokketter::socket_state_cache_mode::TIME_TO_LIVE;
+
+        /**
+         * @brief time in milliseconds a socket state stays fresh in TIME_TO_LIVE and
+         *        STALE_WHILE_REVALIDATE modes.
+         */
+        uint32_t socket_state_cache_ttl_msec = 1000;
+
+        /**
+         * @brief socket_state_cache_ttl_msec overrides keyed by the power strip id.
+         */
+        std::map<std::string, uint32_t> socket_state_cache_ttl_msec_by_device = {};
+
+        sokketter::retry_policy usb_retry_policy = {};
+
+        /**
+         * @attention switching requests are retried as well, they set the socket state instead of
+         * toggling it, so repeating them is safe.
+         */
+        sokketter::retry_policy ethernet_retry_policy = {2, 100, 2.0, 1000, 0.2};
+
+        /**
+         * @brief sends a second status request to Ethernet power strips when the first one is not
+         * answered within the 95th percentile of their recent response times.
+         * @attention both requests are logins, the one answered first is used and the other
+         * session is logged out before it is dropped, as the power strip allows a single session.
+         * This costs an extra logout per hedged read and a strip still busy with the other login
+         * may reject the next one until it answered.
+         */
+        bool is_ethernet_status_hedging_enabled = false;
+
+        /**
+         * @brief reads the socket states of every Ethernet power strip with a password once an
+         * enumeration completes, so the first status read after it is served from memory.
+         * @attention runs in the background and does nothing in ALWAYS_READ cache mode. Pair it
+         * with STALE_WHILE_REVALIDATE or a long TTL, as warmed-up states expire after the TTL.
+         */
+        bool is_ethernet_warm_up_enabled = false;
+
+        /**
+         * @brief maximum number of Ethernet power strips warmed up at the same time.
+         */
+        size_t ethernet_warm_up_concurrency = 4;
     };
 
     /**
@@ -165,7 +348,9 @@ namespace sokketter {
 
     /**
      * @brief starts a background check for a newer release and persists the result to disk.
-     * @attention the check runs on a background thread; deinitialize() waits for it to finish.
+     * @attention the check is skipped while the previous attempt is younger than
+     *            settings_structure::update_check_interval_sec. It runs on a background thread,
+     *            deinitialize() aborts it if it is still running.
      */
     auto EXPORTED check_for_update_async() -> void;
 
@@ -176,6 +361,56 @@ namespace sokketter {
      */
     auto EXPORTED last_update_check_status() -> update_check_status;
 
+    /**
+     * @brief the class signalling cancellation to device calls, all copies share the same state.
+     */
+    class EXPORTED cancellation_token
+    {
+    public:
+        cancellation_token();
+
+        /**
+         * @brief cancels every call using this token or any of its copies.
+         * @attention the running transfer is aborted and no further transfer is started.
+         */
+        auto cancel() const noexcept -> void;
+
+        [[nodiscard]] auto is_cancelled() const noexcept -> bool;
+
+    private:
+        std::shared_ptr<std::atomic_bool> m_is_cancelled = nullptr;
+    };
+
+    /**
+     * @brief structure containing limits of a device call.
+     */
+    struct EXPORTED call_options
+    {
+        /**
+         * @brief time in milliseconds the call may take at most, including all of its retries.
+         * @attention 0 means the call is limited only by the transport timeouts.
+         */
+        uint32_t timeout_msec = 0;
+
+        cancellation_token cancellation = {};
+    };
+
+    /**
+     * @brief the class applying call options to every device call made by the current thread while
+     * it exists.
+     * @attention nested scopes keep the earlier deadline and all cancellation tokens. Asynchronous
+     * functions called within the scope apply its options to their task as well.
+     */
+    class EXPORTED call_scope
+    {
+    public:
+        explicit call_scope(const call_options &options);
+        ~call_scope();
+
+        call_scope(const call_scope &obj) = delete;
+        auto operator=(const call_scope &obj) -> call_scope & = delete;
+    };
+
     /**
      * @brief structure containing configuration parameters of the specific socket.
      */
@@ -191,6 +426,24 @@ namespace sokketter {
         uint32_t configurable_reset_msec = 0;
     };
 
+    /**
+     * @brief state of the socket together with the time it was last seen on the power strip.
+     */
+    struct EXPORTED socket_state
+    {
+        bool is_powered_on = false;
+
+        /**
+         * @brief false if the state could not be read.
+         */
+        bool is_valid = false;
+
+        /**
+         * @brief time since the state was read from or switched on the power strip.
+         */
+        std::chrono::milliseconds age = std::chrono::milliseconds(0);
+    };
+
     /**
      * @brief the class for controlling and configuring the socket.
      */
@@ -199,7 +452,8 @@ namespace sokketter {
     public:
         socket(const socket_configuration &configuration);
         socket(const size_t index, std::function<bool(size_t, bool)> power_cb,
-            std::function<bool(size_t)> status_cb);
+            std::function<bool(size_t)> status_cb,
+            std::function<socket_state(size_t)> state_cb = nullptr);
 
         /**
          * @brief gets current configuration of the socket.
@@ -220,11 +474,18 @@ namespace sokketter {
          */
         auto power(const bool &on) const noexcept -> bool;
 
+        /**
+         * @brief powers on or off the socket within the limits of the call options.
+         * @return true in case of success, false in case of any failure, deadline or cancellation.
+         */
+        auto power(const bool &on, const call_options &options) const noexcept -> bool;
+
         /**
          * @brief toggles the socket state.
          * @return true in case of success, false in case of any failure.
          */
         auto toggle() const noexcept -> bool;
+        auto toggle(const call_options &options) const noexcept -> bool;
 
         /**
          * @brief gets current socket state.
@@ -232,6 +493,21 @@ namespace sokketter {
          */
         [[nodiscard]] auto is_powered_on() const noexcept -> bool;
 
+        /**
+         * @brief gets current socket state together with its age.
+         * @return socket state structure.
+         * @attention never waits for the power strip when the state is served from memory, see
+         * settings_structure::socket_state_cache_mode.
+         */
+        [[nodiscard]] auto state() const noexcept -> socket_state;
+
+        /**
+         * @brief gets current socket state within the limits of the call options.
+         * @return socket state structure, not valid if the deadline passed or the call was
+         * cancelled before the state was read.
+         */
+        [[nodiscard]] auto state(const call_options &options) const noexcept -> socket_state;
+
         /**
          * @brief creates string based on socket status and its parameters.
          * @return string in format "SOCKET_NAME, status: STATUS".
@@ -244,6 +520,7 @@ namespace sokketter {
         size_t m_index = 0;
         std::function<bool(size_t, bool)> m_power_cb = nullptr;
         std::function<bool(size_t)> m_status_cb = nullptr;
+        std::function<socket_state(size_t)> m_state_cb = nullptr;
     };
 
     /**
@@ -356,6 +633,12 @@ namespace sokketter {
          * @attention Read-only, populated internally by the library, not to be set by the user.
          */
         std::string address = "";
+
+        /**
+         * @brief states that the power strip was added by its address and is never discovered.
+         * @attention Read-only, populated internally by the library, not to be set by the user.
+         */
+        bool is_registered = false;
     };
 
     /**
@@ -382,6 +665,7 @@ namespace sokketter {
         /**
          * @brief sets a new configuration of the power strip.
          * @param configuration of the power strip.
+         * @attention power_strip_configuration::is_registered is kept, as only the library sets it.
          */
         auto configure(const power_strip_configuration &configuration) -> void;
 
@@ -403,6 +687,31 @@ namespace sokketter {
          */
         [[nodiscard]] virtual auto is_connected() const -> bool;
 
+        /**
+         * @brief drops the socket states kept in memory, so the next status read of every socket
+         * queries the power strip.
+         */
+        virtual auto invalidate_socket_states() -> void;
+
+        /**
+         * @brief powers several sockets of the power strip on or off.
+         * @param states maps the socket indices, as used by socket(), to the requested states.
+         * @return indices of the sockets that were switched.
+         * @attention power strips accepting several sockets in one request are switched with a
+         * single write, the others socket by socket.
+         */
+        [[nodiscard]] virtual auto power_sockets(const std::map<size_t, bool> &states)
+            -> std::vector<size_t>;
+
+        /**
+         * @brief gets the socket states the power strip was last seen in, kept across restarts in
+         * the device database.
+         * @return states in socket order, not valid for sockets whose state was never read or
+         * switched.
+         * @attention never communicates with the power strip and does not track the age.
+         */
+        [[nodiscard]] virtual auto last_known_socket_states() const -> std::vector<socket_state>;
+
         /**
          * @brief gets list of sockets controlled by the power strip.
          * @return vector of socket objects.
@@ -447,11 +756,20 @@ namespace sokketter {
      * @brief returns the list of power strip devices built upon provided filtering settings.
      * @param filter settings stating which devices to list.
      * @return vector of power_strip objects.
-     * @attention blocking call.
+     * @attention blocking call. The returned list is an immutable snapshot that stays valid until
+     * the same thread calls this function again; rescans from other threads do not change it.
      */
     auto EXPORTED devices(const device_filter &filter = {})
         -> const std::vector<std::shared_ptr<sokketter::power_strip>> &;
 
+    /**
+     * @brief returns the power strips stored in the device database without enumerating them.
+     * @return vector of power_strip objects, disconnected until an enumeration finds them.
+     * @attention non-blocking call, meant for showing the known power strips while an enumeration
+     * is still running.
+     */
+    auto EXPORTED known_devices() -> std::vector<std::shared_ptr<sokketter::power_strip>>;
+
     /**
      * @brief the enum specifying the status of device enumeration.
      */
@@ -495,6 +813,7 @@ namespace sokketter {
      * @brief returns the power strip device by its index.
      * @param index of the device.
      * @return unique pointer to power_strip object or nullptr in case of any failure.
+     * @attention thread-safe, reads the latest published device list without blocking.
      */
     auto EXPORTED device(const size_t &index) -> std::shared_ptr<sokketter::power_strip>;
 
@@ -512,6 +831,311 @@ namespace sokketter {
      */
     auto EXPORTED forget_device(std::shared_ptr<sokketter::power_strip> &device) -> void;
 
+    /**
+     * @brief adds an Ethernet power strip with a fixed address to the storage, so it is available
+     * without any discovery.
+     * @param ip IPv4 address of the power strip.
+     * @param mac MAC address of the power strip, used as its serial number.
+     * @param password used to log in to the power strip, empty keeps the stored one.
+     * @return shared pointer to the power strip or nullptr in case of any failure.
+     * @attention the power strip is not contacted, its reachability is checked by the first
+     * operation.
+     */
+    auto EXPORTED add_ethernet_device(const std::string &ip, const std::string &mac,
+        const std::string &password = "") -> std::shared_ptr<sokketter::power_strip>;
+
+    /**
+     * @brief starts recording all USB control transfers and LAN HTTP exchanges to a binary trace.
+     * @param path of the trace file, overwritten if it exists.
+     * @return true in case of success, false in case of any failure.
+     * @attention login passwords are redacted from the recorded HTTP requests.
+     */
+    auto EXPORTED start_io_trace(const std::filesystem::path &path) -> bool;
+
+    /**
+     * @brief stops the running I/O trace recording and closes the trace file.
+     */
+    auto EXPORTED stop_io_trace() -> void;
+
+    /**
+     * @brief creates power strips driven by the exchanges stored in a recorded I/O trace.
+     * @param path of the trace file.
+     * @param speed replay speed factor, 1.0 reproduces recorded timings, 0 replays without waiting.
+     * @return power strips present in the trace, empty in case of any failure.
+     * @attention replayed power strips never talk to real devices and are not stored in the
+     * database; every operation consumes the next recorded exchange of its power strip.
+     */
+    auto EXPORTED replay_io_trace(const std::filesystem::path &path, const double &speed = 1.0)
+        -> std::vector<std::shared_ptr<sokketter::power_strip>>;
+
+    /**
+     * @brief type alias for the function running asynchronous device tasks.
+     * @attention the executor must run every submitted task exactly once, on any thread.
+     */
+    using executor = std::function<void(std::function<void()>)>;
+
+    /**
+     * @brief sets the executor used by all asynchronous device functions.
+     * @param executor function running submitted tasks, nullptr restores the library I/O pool.
+     * @attention tasks already submitted keep running on the executor they were submitted to.
+     */
+    auto EXPORTED set_executor(executor executor) -> void;
+
+    /**
+     * @brief type alias for the completion callback of asynchronous operations.
+     * @attention called on the executor thread, not on the thread that started the operation.
+     */
+    using completion_callback = std::function<void(bool)>;
+
+    /**
+     * @brief type alias for the completion callback of asynchronous bulk status reads.
+     * @attention called on the executor thread, not on the thread that started the operation.
+     */
+    using status_all_callback = std::function<void(std::vector<bool>)>;
+
+    /**
+     * @brief powers on or off the socket of the power strip without blocking.
+     * @param device power strip owning the socket.
+     * @param socket_index zero-based index of the socket.
+     * @param on specifies to which state socket should be switched.
+     * @return future set to true in case of success, false in case of any failure.
+     * @attention operations on the same power strip are serialized, different power strips are
+     * accessed in parallel.
+     */
+    auto EXPORTED power_async(std::shared_ptr<power_strip> device, const size_t &socket_index,
+        const bool &on) -> std::future<bool>;
+
+    /**
+     * @brief powers on or off the socket of the power strip without blocking.
+     * @param device power strip owning the socket.
+     * @param socket_index zero-based index of the socket.
+     * @param on specifies to which state socket should be switched.
+     * @param completion_cb receives true in case of success, false in case of any failure.
+     */
+    auto EXPORTED power_async(std::shared_ptr<power_strip> device, const size_t &socket_index,
+        const bool &on, completion_callback completion_cb) -> void;
+
+    /**
+     * @brief gets the socket state of the power strip without blocking.
+     * @param device power strip owning the socket.
+     * @param socket_index zero-based index of the socket.
+     * @return future set to true if powered on, false if powered off or in case of any failure.
+     */
+    auto EXPORTED status_async(std::shared_ptr<power_strip> device, const size_t &socket_index)
+        -> std::future<bool>;
+
+    /**
+     * @brief gets the socket state of the power strip without blocking.
+     * @param device power strip owning the socket.
+     * @param socket_index zero-based index of the socket.
+     * @param completion_cb receives true if powered on, false if powered off or in case of any
+     * failure.
+     */
+    auto EXPORTED status_async(std::shared_ptr<power_strip> device, const size_t &socket_index,
+        completion_callback completion_cb) -> void;
+
+    /**
+     * @brief tries to authenticate the power strip without blocking.
+     * @param device power strip to authenticate.
+     * @return future set to true in case of success, false in case of any failure.
+     */
+    auto EXPORTED authenticate_async(std::shared_ptr<power_strip> device) -> std::future<bool>;
+
+    /**
+     * @brief tries to authenticate the power strip without blocking.
+     * @param device power strip to authenticate.
+     * @param completion_cb receives true in case of success, false in case of any failure.
+     */
+    auto EXPORTED authenticate_async(
+        std::shared_ptr<power_strip> device, completion_callback completion_cb) -> void;
+
+    /**
+     * @brief powers on or off all sockets of the power strip without blocking.
+     * @param device power strip owning the sockets.
+     * @param on specifies to which state sockets should be switched.
+     * @return future set to true if all sockets were switched, false in case of any failure.
+     */
+    auto EXPORTED power_all_async(std::shared_ptr<power_strip> device, const bool &on)
+        -> std::future<bool>;
+
+    /**
+     * @brief powers on or off all sockets of the power strip without blocking.
+     * @param device power strip owning the sockets.
+     * @param on specifies to which state sockets should be switched.
+     * @param completion_cb receives true if all sockets were switched, false in case of any
+     * failure.
+     */
+    auto EXPORTED power_all_async(std::shared_ptr<power_strip> device, const bool &on,
+        completion_callback completion_cb) -> void;
+
+    /**
+     * @brief gets the states of all sockets of the power strip without blocking.
+     * @param device power strip owning the sockets.
+     * @return future set to socket states in socket order, empty in case of any failure.
+     */
+    auto EXPORTED status_all_async(std::shared_ptr<power_strip> device)
+        -> std::future<std::vector<bool>>;
+
+    /**
+     * @brief gets the states of all sockets of the power strip without blocking.
+     * @param device power strip owning the sockets.
+     * @param completion_cb receives socket states in socket order, empty in case of any failure.
+     */
+    auto EXPORTED status_all_async(
+        std::shared_ptr<power_strip> device, status_all_callback completion_cb) -> void;
+
+    /**
+     * @brief the enum specifying outcomes of reconciling a single socket.
+     */
+    enum class reconciliation_result : uint8_t
+    {
+        /**
+         * @brief the socket was in the desired state already, nothing was written.
+         */
+        UNCHANGED = 0,
+
+        /**
+         * @brief the socket was switched and read back in the desired state.
+         */
+        SWITCHED = 1,
+
+        /**
+         * @brief switching failed or the socket was read back in another state.
+         */
+        FAILED = 2,
+
+        UNKNOWN_DEVICE = 3,
+        UNKNOWN_SOCKET = 4
+    };
+
+    /**
+     * @brief structure containing the outcome of reconciling a single socket.
+     */
+    struct EXPORTED socket_reconciliation
+    {
+        std::string device_id = "";
+
+        /**
+         * @brief zero-based index of the socket.
+         */
+        size_t socket_index = 0;
+
+        bool is_powered_on = false;
+        reconciliation_result result = reconciliation_result::FAILED;
+    };
+
+    /**
+     * @brief type alias for desired socket states, keyed by power strip id and zero-based socket
+     * index.
+     */
+    using desired_socket_states = std::map<std::string, std::map<size_t, bool>>;
+
+    /**
+     * @brief brings sockets of many power strips into their desired states.
+     * @param devices power strips the desired states refer to.
+     * @param desired_states states to reach.
+     * @return outcome of every socket in desired_states, ordered by power strip id and socket
+     * index.
+     * @attention current states are taken from the socket state cache where possible, so applying
+     * an unchanged plan again costs only reads. Only sockets in another state are switched, and
+     * they are read again afterwards to verify the switch. Power strips are reconciled in parallel
+     * on the executor, so this function must not be called from an asynchronous device task.
+     */
+    auto EXPORTED reconcile(const std::vector<std::shared_ptr<power_strip>> &devices,
+        const desired_socket_states &desired_states) -> std::vector<socket_reconciliation>;
+
+    /**
+     * @brief structure referring to a single socket of a power strip.
+     */
+    struct EXPORTED socket_reference
+    {
+        std::string device_id = "";
+
+        /**
+         * @brief zero-based index of the socket.
+         */
+        size_t socket_index = 0;
+    };
+
+    /**
+     * @brief structure containing a named set of sockets spanning one or many power strips, e.g.
+     * all sockets of a test bench.
+     */
+    struct EXPORTED socket_group
+    {
+        std::string name = "";
+        std::string description = "";
+        std::vector<socket_reference> sockets = {};
+    };
+
+    /**
+     * @brief structure containing named desired states of sockets spanning one or many power
+     * strips.
+     */
+    struct EXPORTED socket_scene
+    {
+        std::string name = "";
+        std::string description = "";
+        desired_socket_states states = {};
+    };
+
+    /**
+     * @brief gets the socket groups stored in the device database.
+     * @return groups ordered by name.
+     */
+    auto EXPORTED groups() -> std::vector<socket_group>;
+
+    /**
+     * @brief stores the socket group in the device database, replacing the group with the same
+     * name.
+     */
+    auto EXPORTED save_group(const socket_group &group) -> void;
+
+    /**
+     * @brief removes the socket group from the device database.
+     * @return true if the group was stored, false otherwise.
+     */
+    auto EXPORTED forget_group(const std::string &name) -> bool;
+
+    /**
+     * @brief gets the scenes stored in the device database.
+     * @return scenes ordered by name.
+     */
+    auto EXPORTED scenes() -> std::vector<socket_scene>;
+
+    /**
+     * @brief stores the scene in the device database, replacing the scene with the same name.
+     */
+    auto EXPORTED save_scene(const socket_scene &scene) -> void;
+
+    /**
+     * @brief removes the scene from the device database.
+     * @return true if the scene was stored, false otherwise.
+     */
+    auto EXPORTED forget_scene(const std::string &name) -> bool;
+
+    /**
+     * @brief powers all sockets of the stored group on or off.
+     * @param devices power strips the group refers to.
+     * @param name of the group.
+     * @param on true to power the sockets on, false to power them off.
+     * @return outcome of every socket of the group, empty if no group with the name is stored.
+     * @attention executed via reconcile(), so the sockets are grouped by power strip, only sockets
+     * in another state are switched and power strips are switched in parallel.
+     */
+    auto EXPORTED power_group(const std::vector<std::shared_ptr<power_strip>> &devices,
+        const std::string &name, const bool &on) -> std::vector<socket_reconciliation>;
+
+    /**
+     * @brief brings the sockets of the stored scene into their states.
+     * @param devices power strips the scene refers to.
+     * @param name of the scene.
+     * @return outcome of every socket of the scene, empty if no scene with the name is stored.
+     * @attention executed via reconcile(), see power_group().
+     */
+    auto EXPORTED apply_scene(const std::vector<std::shared_ptr<power_strip>> &devices,
+        const std::string &name) -> std::vector<socket_reconciliation>;
+
 } // namespace sokketter
 
 #endif // LIBSOKKETTER_H
@@ -0,0 +1,87 @@
+#include "call_context.h"
+
+#include <sokketter_core.h>
+
+#include <algorithm>
+
+namespace {
+    thread_local std::vector<call_context::frame> frames;
+}
+
+auto call_context::enter(const sokketter::call_options &options) -> void
+{
+    frame entered = frames.empty() ? frame() : frames.back();
+
+    if (options.timeout_msec > 0)
+    {
+        entered.deadline = std::min(entered.deadline,
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(options.timeout_msec));
+    }
+
+    entered.cancellations.push_back(options.cancellation);
+
+    frames.push_back(entered);
+}
+
+auto call_context::enter(const frame &frame) -> void
+{
+    frames.push_back(frame);
+}
+
+auto call_context::leave() -> void
+{
+    if (!frames.empty())
+    {
+        frames.pop_back();
+    }
+}
+
+call_context::scope::scope(const frame &frame)
+{
+    enter(frame);
+}
+
+call_context::scope::~scope()
+{
+    leave();
+}
+
+auto call_context::current() -> frame
+{
+    return frames.empty() ? frame() : frames.back();
+}
+
+auto call_context::is_expired() -> bool
+{
+    if (sokketter_core::instance().is_device_io_aborted())
+    {
+        return true;
+    }
+
+    if (frames.empty())
+    {
+        return false;
+    }
+
+    const auto &current = frames.back();
+    if (std::chrono::steady_clock::now() >= current.deadline)
+    {
+        return true;
+    }
+
+    return std::any_of(current.cancellations.begin(), current.cancellations.end(),
+        [](const sokketter::cancellation_token &token) { return token.is_cancelled(); });
+}
+
+auto call_context::remaining(const std::chrono::milliseconds &limit) -> std::chrono::milliseconds
+{
+    if (frames.empty() || frames.back().deadline == std::chrono::steady_clock::time_point::max())
+    {
+        return limit;
+    }
+
+    const auto left = std::chrono::ceil<std::chrono::milliseconds>(
+        frames.back().deadline - std::chrono::steady_clock::now());
+
+    return std::min(limit, std::max(left, std::chrono::milliseconds(1)));
+}
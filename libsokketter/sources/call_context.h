@@ -0,0 +1,64 @@
+#ifndef CALL_CONTEXT_H
+#define CALL_CONTEXT_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <chrono>
+#include <vector>
+
+/**
+ * @brief deadline and cancellation of the device call running on the current thread, as set by
+ * sokketter::call_scope.
+ */
+namespace call_context {
+    /**
+     * @brief deadline and cancellation tokens of a scope, merged with those of the enclosing ones.
+     */
+    struct frame
+    {
+        std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::time_point::max();
+        std::vector<sokketter::cancellation_token> cancellations = {};
+    };
+
+    auto enter(const sokketter::call_options &options) -> void;
+    auto enter(const frame &frame) -> void;
+    auto leave() -> void;
+
+    /**
+     * @brief enters the frame for its lifetime, so a throwing task does not leave it on the stack
+     * of a pool worker.
+     */
+    class scope
+    {
+    public:
+        explicit scope(const frame &frame);
+        ~scope();
+
+        scope(const scope &obj) = delete;
+        auto operator=(const scope &obj) -> scope & = delete;
+    };
+
+    /**
+     * @brief gets the frame of the innermost scope, so it can be entered on another thread.
+     */
+    auto current() -> frame;
+
+    /**
+     * @brief checks whether the running call has to stop its I/O.
+     * @return true if the deadline passed, the call was cancelled or the library is
+     * deinitializing, false otherwise.
+     */
+    auto is_expired() -> bool;
+
+    /**
+     * @brief gets the time left until the deadline, capped by the given limit.
+     * @return the limit if no deadline is set, otherwise at least 1 ms, so it can be used as a
+     * transport timeout.
+     */
+    auto remaining(const std::chrono::milliseconds &limit) -> std::chrono::milliseconds;
+} // namespace call_context
+
+#endif // CALL_CONTEXT_H
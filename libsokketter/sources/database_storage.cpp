@@ -4,6 +4,9 @@
 #include <devices/power_strip_factory.h>
 #include <sokketter_core.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <fstream>
 #include <json/json.hpp>
 #include <spdlog/spdlog.h>
@@ -51,14 +54,24 @@ namespace sokketter {
             return;
         }
 
-        std::vector<sokketter::socket_configuration> sockets = {};
-        for (const auto &socket : ps.sockets())
+        const auto &states = ps.last_known_socket_states();
+
+        auto sockets = nlohmann::json::array();
+        for (size_t index = 0; index < ps.sockets().size(); index++)
         {
-            sockets.push_back(socket.configuration());
+            nlohmann::json socket = ps.sockets()[index].configuration();
+            if (index < states.size() && states[index].is_valid)
+            {
+                socket["last-powered-on"] = states[index].is_powered_on;
+            }
+
+            sockets.push_back(socket);
         }
 
         j = nlohmann::json{{"type", ps.configuration().type}, {"id", ps.configuration().id},
             {"name", ps.configuration().name}, {"description", ps.configuration().description},
+            {"address", ps.configuration().address},
+            {"registered", ps.configuration().is_registered},
             {"authentication-type", ps.configuration().authentication.type},
             {"authentication-password", ps.configuration().authentication.password},
             {"sockets", sockets}};
@@ -72,6 +85,7 @@ namespace sokketter {
         configuration.id = j.value("id", "");
         configuration.name = j.value("name", "");
         configuration.description = j.value("description", "");
+        configuration.address = j.value("address", "");
         configuration.authentication.type =
             j.value("authentication-type", sokketter::power_strip_authentication_type::UNKNOWN);
         configuration.authentication.password = j.value("authentication-password", "");
@@ -121,6 +135,18 @@ namespace sokketter {
             if (auto *basePtr = dynamic_cast<power_strip_base *>(ptr.get()))
             {
                 basePtr->copyFrom(power_strip);
+                basePtr->set_registered(j.value("registered", false));
+
+                std::vector<sokketter::socket_state> states;
+                for (const auto &socket : j.value("sockets", nlohmann::json::array()))
+                {
+                    sokketter::socket_state state;
+                    state.is_valid = socket.contains("last-powered-on");
+                    state.is_powered_on = socket.value("last-powered-on", false);
+                    states.push_back(state);
+                }
+
+                basePtr->restore_last_known_socket_states(states);
             }
             else
             {
@@ -129,11 +155,81 @@ namespace sokketter {
             }
         }
     }
+
+    void to_json(nlohmann::json &j, const sokketter::socket_reference &s)
+    {
+        j = nlohmann::json{{"device-id", s.device_id}, {"socket-index", s.socket_index}};
+    }
+
+    void from_json(const nlohmann::json &j, sokketter::socket_reference &s)
+    {
+        s.device_id = j.value("device-id", "");
+        s.socket_index = j.value("socket-index", 0);
+    }
+
+    void to_json(nlohmann::json &j, const sokketter::socket_group &g)
+    {
+        j = nlohmann::json{
+            {"name", g.name}, {"description", g.description}, {"sockets", g.sockets}};
+    }
+
+    void from_json(const nlohmann::json &j, sokketter::socket_group &g)
+    {
+        g.name = j.value("name", "");
+        g.description = j.value("description", "");
+        g.sockets = j.value("sockets", std::vector<sokketter::socket_reference>());
+    }
+
+    void to_json(nlohmann::json &j, const sokketter::socket_scene &s)
+    {
+        auto sockets = nlohmann::json::array();
+        for (const auto &[device_id, device_states] : s.states)
+        {
+            for (const auto &[socket_index, is_powered_on] : device_states)
+            {
+                sockets.push_back({{"device-id", device_id}, {"socket-index", socket_index},
+                    {"powered-on", is_powered_on}});
+            }
+        }
+
+        j = nlohmann::json{{"name", s.name}, {"description", s.description}, {"sockets", sockets}};
+    }
+
+    void from_json(const nlohmann::json &j, sokketter::socket_scene &s)
+    {
+        s.name = j.value("name", "");
+        s.description = j.value("description", "");
+        s.states.clear();
+
+        for (const auto &socket : j.value("sockets", nlohmann::json::array()))
+        {
+            s.states[socket.value("device-id", "")][socket.value("socket-index", size_t{0})] =
+                socket.value("powered-on", false);
+        }
+    }
 } // namespace sokketter
 
-auto database_storage::get() -> std::vector<std::shared_ptr<sokketter::power_strip>> &
+auto database_storage::get() const -> std::shared_ptr<const device_list>
+{
+    return std::atomic_load(&m_devices);
+}
+
+auto database_storage::update(const std::function<void(device_list &)> &modifier)
+    -> std::shared_ptr<const device_list>
 {
-    return m_devices;
+    const std::lock_guard<std::mutex> lock(m_update_mutex);
+
+    auto devices = std::make_shared<device_list>(*get());
+    modifier(*devices);
+
+    publish(devices);
+
+    return devices;
+}
+
+auto database_storage::publish(std::shared_ptr<const device_list> devices) -> void
+{
+    std::atomic_store(&m_devices, std::move(devices));
 }
 
 auto database_storage::save() const -> void
@@ -141,6 +237,18 @@ auto database_storage::save() const -> void
     SPDLOG_LOGGER_DEBUG(
         SOKKETTER_LOGGER, "Saving the device database to '{}' file.", path().string());
 
+    const auto devices = get();
+
+    nlohmann::json j = {{"devices", *devices}, {"groups", groups()}, {"scenes", scenes()}};
+
+    const std::lock_guard<std::mutex> lock(m_file_mutex);
+
+    /**
+     * @attention the storage folder is created on the first save instead of on initialization.
+     */
+    std::error_code error_code;
+    std::filesystem::create_directories(path().parent_path(), error_code);
+
     std::ofstream file(path().string());
     if (!file.is_open())
     {
@@ -149,16 +257,28 @@ auto database_storage::save() const -> void
         return;
     }
 
-    nlohmann::json j = m_devices;
     file << j.dump(4);
 }
 
 auto database_storage::load() -> void
 {
+    {
+        const std::lock_guard<std::mutex> lock(m_path_mutex);
+        m_path = resolve_path();
+    }
+
     SPDLOG_LOGGER_DEBUG(
         SOKKETTER_LOGGER, "Restoring the device database from '{}' file.", path().string());
 
-    m_devices.clear();
+    const std::lock_guard<std::mutex> lock(m_update_mutex);
+
+    publish(std::make_shared<const device_list>());
+
+    {
+        const std::lock_guard<std::mutex> collections_lock(m_collections_mutex);
+        m_groups.clear();
+        m_scenes.clear();
+    }
 
     if (!std::filesystem::exists(path()))
     {
@@ -180,8 +300,31 @@ auto database_storage::load() -> void
     {
         file >> j;
 
-        auto devices = j.get<std::vector<std::shared_ptr<sokketter::power_strip>>>();
-        m_devices = std::move(devices);
+        /**
+         * @attention databases saved before groups and scenes were introduced hold the bare
+         * device list.
+         */
+        if (j.is_array())
+        {
+            j = {{"devices", j}};
+        }
+
+        auto devices = j.value("devices", device_list());
+        const auto &groups = j.value("groups", std::vector<sokketter::socket_group>());
+        const auto &scenes = j.value("scenes", std::vector<sokketter::socket_scene>());
+
+        publish(std::make_shared<const device_list>(std::move(devices)));
+
+        const std::lock_guard<std::mutex> collections_lock(m_collections_mutex);
+        for (const auto &group : groups)
+        {
+            m_groups[group.name] = group;
+        }
+
+        for (const auto &scene : scenes)
+        {
+            m_scenes[scene.name] = scene;
+        }
     }
     catch (const nlohmann::json::exception &exception)
     {
@@ -194,24 +337,114 @@ auto database_storage::load() -> void
 
 auto database_storage::remove(std::shared_ptr<sokketter::power_strip> &power_strip) -> void
 {
-    m_devices.erase(
-        std::remove_if(m_devices.begin(), m_devices.end(),
-            [&](const std::shared_ptr<sokketter::power_strip> &ptr) { return ptr == power_strip; }),
-        m_devices.end());
+    update([&](device_list &devices) {
+        devices.erase(std::remove_if(devices.begin(), devices.end(),
+                          [&](const std::shared_ptr<sokketter::power_strip> &ptr) {
+                              return ptr == power_strip;
+                          }),
+            devices.end());
+    });
 }
 
 auto database_storage::release_resources() -> void
 {
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Releasing device database resources.");
 
-    for (auto &device : m_devices)
+    /**
+     * @attention readers still holding an older snapshot keep their devices alive until they
+     * release it.
+     */
+    const std::lock_guard<std::mutex> lock(m_update_mutex);
+    publish(std::make_shared<const device_list>());
+
+    const std::lock_guard<std::mutex> collections_lock(m_collections_mutex);
+    m_groups.clear();
+    m_scenes.clear();
+}
+
+auto database_storage::groups() const -> std::vector<sokketter::socket_group>
+{
+    const std::lock_guard<std::mutex> lock(m_collections_mutex);
+
+    std::vector<sokketter::socket_group> groups;
+    for (const auto &[name, group] : m_groups)
+    {
+        groups.push_back(group);
+    }
+
+    return groups;
+}
+
+auto database_storage::store_group(const sokketter::socket_group &group) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_collections_mutex);
+    m_groups[group.name] = group;
+}
+
+auto database_storage::remove_group(const std::string &name) -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_collections_mutex);
+    return m_groups.erase(name) > 0;
+}
+
+auto database_storage::scenes() const -> std::vector<sokketter::socket_scene>
+{
+    const std::lock_guard<std::mutex> lock(m_collections_mutex);
+
+    std::vector<sokketter::socket_scene> scenes;
+    for (const auto &[name, scene] : m_scenes)
     {
-        device.reset();
-        device = nullptr;
+        scenes.push_back(scene);
     }
+
+    return scenes;
+}
+
+auto database_storage::store_scene(const sokketter::socket_scene &scene) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_collections_mutex);
+    m_scenes[scene.name] = scene;
+}
+
+auto database_storage::remove_scene(const std::string &name) -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_collections_mutex);
+    return m_scenes.erase(name) > 0;
+}
+
+auto get_requested_test_database_path() -> std::filesystem::path
+{
+    /**
+     * @attention lets tests point the database at a temp file instead of the real storage path.
+     */
+    const char *value = std::getenv("LIBSOKKETTER_TEST_DATABASE_PATH");
+    if (value == nullptr || value[0] == '\0')
+    {
+        return {};
+    }
+
+    return value;
 }
 
 auto database_storage::path() const -> std::filesystem::path
 {
+    const std::lock_guard<std::mutex> lock(m_path_mutex);
+
+    if (m_path.empty())
+    {
+        m_path = resolve_path();
+    }
+
+    return m_path;
+}
+
+auto database_storage::resolve_path() -> std::filesystem::path
+{
+    const auto &test_path = get_requested_test_database_path();
+    if (!test_path.empty())
+    {
+        return test_path;
+    }
+
     return sokketter::storage_path() / "devices.json";
 }
@@ -6,26 +6,105 @@
 #include <libsokketter.h>
 
 #include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
+/**
+ * @brief keeps the list of known power strips together with the socket groups and scenes and
+ * persists them to disk.
+ *
+ * The list is published as immutable snapshots: readers take the current snapshot without locking
+ * and keep using it even if an enumeration publishes a newer one, while writers build a modified
+ * copy and swap it in atomically.
+ */
 class database_storage
 {
 public:
+    using device_list = std::vector<std::shared_ptr<sokketter::power_strip>>;
+
     database_storage() = default;
     ~database_storage() = default;
 
-    auto get() -> std::vector<std::shared_ptr<sokketter::power_strip>> &;
+    /**
+     * @brief gets the currently published snapshot of the device list.
+     * @return immutable device list, never nullptr.
+     */
+    auto get() const -> std::shared_ptr<const device_list>;
+
+    /**
+     * @brief applies the modifier to a copy of the device list and publishes the result.
+     * @param modifier function changing the copied list.
+     * @return newly published snapshot.
+     * @attention writers are serialized, the modifier must not call back into the storage.
+     */
+    auto update(const std::function<void(device_list &)> &modifier)
+        -> std::shared_ptr<const device_list>;
 
     auto save() const -> void;
     auto load() -> void;
 
-    auto remove(std::shared_ptr<sokketter::power_strip>& power_strip) -> void;
+    auto remove(std::shared_ptr<sokketter::power_strip> &power_strip) -> void;
+
+    auto groups() const -> std::vector<sokketter::socket_group>;
+
+    /**
+     * @brief stores the group, replacing the group with the same name.
+     */
+    auto store_group(const sokketter::socket_group &group) -> void;
+    auto remove_group(const std::string &name) -> bool;
+
+    auto scenes() const -> std::vector<sokketter::socket_scene>;
+
+    /**
+     * @brief stores the scene, replacing the scene with the same name.
+     */
+    auto store_scene(const sokketter::socket_scene &scene) -> void;
+    auto remove_scene(const std::string &name) -> bool;
 
     auto release_resources() -> void;
 
+    /**
+     * @brief gets the path of the database file, resolved once per load().
+     */
     auto path() const -> std::filesystem::path;
 
 private:
-    std::vector<std::shared_ptr<sokketter::power_strip>> m_devices;
+    std::shared_ptr<const device_list> m_devices = std::make_shared<const device_list>();
+
+    /**
+     * @brief groups and scenes keyed by their names, so they are kept ordered and unique.
+     */
+    std::map<std::string, sokketter::socket_group> m_groups;
+    std::map<std::string, sokketter::socket_scene> m_scenes;
+
+    /**
+     * @brief guards the groups and scenes.
+     */
+    mutable std::mutex m_collections_mutex;
+
+    /**
+     * @brief serializes writers publishing a new snapshot.
+     */
+    std::mutex m_update_mutex;
+
+    /**
+     * @brief serializes writes of the database file.
+     */
+    mutable std::mutex m_file_mutex;
+
+    /**
+     * @brief path of the database file, resolved by load() or the first path() call.
+     */
+    mutable std::mutex m_path_mutex;
+    mutable std::filesystem::path m_path = "";
+
+    static auto resolve_path() -> std::filesystem::path;
+
+    auto publish(std::shared_ptr<const device_list> devices) -> void;
 };
 
 #endif // DATABASE_STORAGE_H
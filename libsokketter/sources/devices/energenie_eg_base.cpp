@@ -1,9 +1,11 @@
 #include "energenie_eg_base.h"
 
+#include <algorithm>
 #include <array>
 #include <sokketter_core.h>
 #include <spdlog/spdlog.h>
 #include <sstream>
+#include <transfer_policy.h>
 
 std::mutex energenie_eg_base::m_usb_communication_mutex;
 
@@ -22,23 +24,33 @@ energenie_eg_base::energenie_eg_base()
 auto energenie_eg_base::initialize(std::shared_ptr<kommpot::device_communication> communication)
     -> bool
 {
-    std::lock_guard<std::mutex> lock(m_usb_communication_mutex);
-
     if (!power_strip_base::initialize(communication))
     {
         return false;
     }
 
     /**
-     * Read device serial number from device since it is not available in USB descriptor.
+     * @brief unchanged USB topology entries keep their serial number, so re-enumerating them needs
+     * no device I/O.
      */
-    if (!m_communication->open())
+    const auto &identification_variant = communication->identification();
+    if (const auto *identification =
+            std::get_if<kommpot::usb_device_identification>(&identification_variant))
     {
-        SPDLOG_LOGGER_ERROR(
-            SOKKETTER_LOGGER, "{}: failed opening the device communication!", this->to_string());
-        return false;
+        m_serial_cache_key = usb_serial_cache::key(*identification);
+    }
+
+    auto &serial_cache = sokketter_core::instance().serial_cache();
+    if (!m_serial_cache_key.empty() && serial_cache.find(m_serial_cache_key, m_serial_number))
+    {
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: using the cached serial number {}.",
+            this->to_string(), m_serial_number);
+        return true;
     }
 
+    /**
+     * Read device serial number from device since it is not available in USB descriptor.
+     */
     kommpot::control_transfer_configuration configuration;
     configuration.request_type = 0xa1;
     configuration.request = 0x01;
@@ -48,9 +60,7 @@ auto energenie_eg_base::initialize(std::shared_ptr<kommpot::device_communication
     std::array<uint8_t, 5> serial_number_raw = {0};
 
     const bool is_read_succeed =
-        m_communication->read(configuration, serial_number_raw.data(), serial_number_raw.size());
-
-    m_communication->close();
+        control_read(configuration, serial_number_raw.data(), serial_number_raw.size());
 
     if (!is_read_succeed)
     {
@@ -71,6 +81,24 @@ auto energenie_eg_base::initialize(std::shared_ptr<kommpot::device_communication
 
     m_serial_number = serial_number.str();
 
+    if (!m_serial_cache_key.empty())
+    {
+        serial_cache.store(m_serial_cache_key, m_serial_number);
+    }
+
+    return true;
+}
+
+auto energenie_eg_base::initialize(std::shared_ptr<io_trace_replay> replay,
+    const sokketter::power_strip_configuration &configuration) -> bool
+{
+    if (!power_strip_base::initialize(replay, configuration))
+    {
+        return false;
+    }
+
+    m_serial_number = configuration.id;
+
     return true;
 }
 
@@ -84,9 +112,9 @@ auto energenie_eg_base::try_authenticate() -> bool
 
 auto energenie_eg_base::power_socket(size_t index, bool is_toggled) -> bool
 {
-    std::lock_guard<std::mutex> lock(m_usb_communication_mutex);
+    const std::lock_guard<std::mutex> lock(m_io_mutex);
 
-    if (m_communication == nullptr)
+    if (!is_connected())
     {
         SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
             "{}: skipping powering socket due to disconnected status.", this->to_string(), index);
@@ -108,39 +136,32 @@ auto energenie_eg_base::power_socket(size_t index, bool is_toggled) -> bool
         buffer = {uint8_t(3 * index), 0x03, 0x00, 0x00, 0x00};
     }
 
-    if (!m_communication->open())
-    {
-        SPDLOG_LOGGER_ERROR(
-            SOKKETTER_LOGGER, "{}: failed opening the device communication!", this->to_string());
-        return false;
-    }
-
-    const bool is_operation_succeed =
-        m_communication->write(configuration, buffer.data(), buffer.size());
-
-    m_communication->close();
+    const bool is_operation_succeed = control_write(configuration, buffer.data(), buffer.size());
 
     if (!is_operation_succeed)
     {
         SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: failed writing the command!", this->to_string());
+
+        /**
+         * @attention the device may or may not have switched, so the cached states are not
+         * trusted anymore.
+         */
+        m_socket_states.invalidate();
         return false;
     }
 
+    m_socket_states.store(index, is_toggled);
+
     return true;
 }
 
 auto energenie_eg_base::socket_status(size_t index) -> bool
 {
-    std::lock_guard<std::mutex> lock(m_usb_communication_mutex);
-
-    if (m_communication == nullptr)
-    {
-        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
-            "{}: skipping checking socket status due to disconnected status.", this->to_string(),
-            index);
-        return false;
-    }
+    return cached_socket_state(index).is_powered_on;
+}
 
+auto energenie_eg_base::read_socket_state(size_t index, bool &is_powered_on) -> bool
+{
     SPDLOG_LOGGER_DEBUG(
         SOKKETTER_LOGGER, "{}: checking socket {} status.", this->to_string(), index);
 
@@ -152,23 +173,140 @@ auto energenie_eg_base::socket_status(size_t index) -> bool
 
     std::array<uint8_t, 5> buffer = {uint8_t(3 * index), 0x03, 0x00, 0x00, 0x00};
 
+    const bool is_operation_succeed = control_read(configuration, buffer.data(), buffer.size());
+
+    if (!is_operation_succeed)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: failed reading the status!", this->to_string());
+        return false;
+    }
+
+    is_powered_on = bool(1 & buffer[1]);
+    m_socket_states.store(index, is_powered_on);
+
+    return true;
+}
+
+auto energenie_eg_base::control_read(
+    const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+    -> bool
+{
+    return control_transfer(io_trace_record_type::USB_CONTROL_READ, configuration, data, size);
+}
+
+auto energenie_eg_base::control_write(
+    const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+    -> bool
+{
+    return control_transfer(io_trace_record_type::USB_CONTROL_WRITE, configuration, data, size);
+}
+
+auto energenie_eg_base::control_transfer(const io_trace_record_type &type,
+    const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+    -> bool
+{
+    const bool is_operation_succeed =
+        transfer_policy::retry(sokketter_core::instance().usb_retry_policy(), this->to_string(),
+            [&]() { return control_transfer_attempt(type, configuration, data, size); });
+
+    /**
+     * @attention a failing transfer may mean the device was replugged, so its serial number is
+     * read again on the next enumeration.
+     */
+    if (!is_operation_succeed && m_replay == nullptr && !m_serial_cache_key.empty())
+    {
+        sokketter_core::instance().serial_cache().invalidate(m_serial_cache_key);
+    }
+
+    return is_operation_succeed;
+}
+
+auto energenie_eg_base::control_transfer_attempt(const io_trace_record_type &type,
+    const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+    -> bool
+{
+    if (m_replay != nullptr)
+    {
+        const auto &record = m_replay->next(m_serial_number, type);
+        if (!record.has_value())
+        {
+            return false;
+        }
+
+        if (type == io_trace_record_type::USB_CONTROL_READ)
+        {
+            std::copy_n(
+                record->response_data.begin(), std::min(size, record->response_data.size()), data);
+        }
+
+        return record->is_successful;
+    }
+
+    auto &recorder = sokketter_core::instance().io_trace();
+    const bool is_recording = recorder.is_recording();
+
+    io_trace_record record;
+    if (is_recording)
+    {
+        record.type = type;
+        record.timestamp_usec = recorder.elapsed_usec();
+        record.request_type = configuration.request_type;
+        record.request = configuration.request;
+        record.value = configuration.value;
+        record.index = configuration.index;
+        /**
+         * @attention the serial number is read by the first transfer, which is therefore keyed by
+         * the USB topology of the device.
+         */
+        record.device_id = m_serial_number.empty() ? m_serial_cache_key : m_serial_number;
+
+        if (type == io_trace_record_type::USB_CONTROL_WRITE)
+        {
+            record.request_data.assign(reinterpret_cast<const char *>(data), size);
+        }
+    }
+
+    bool is_operation_succeed = false;
+
+    /**
+     * @attention the USB communication is shared by all power strips, so it is locked for a single
+     * attempt only and the backoff between attempts does not stall the other power strips.
+     */
+    std::unique_lock<std::mutex> lock(m_usb_communication_mutex);
+
     if (!m_communication->open())
     {
         SPDLOG_LOGGER_ERROR(
             SOKKETTER_LOGGER, "{}: failed opening the device communication!", this->to_string());
-        return false;
     }
+    else
+    {
+        if (type == io_trace_record_type::USB_CONTROL_READ)
+        {
+            is_operation_succeed = m_communication->read(configuration, data, size);
+        }
+        else
+        {
+            is_operation_succeed = m_communication->write(configuration, data, size);
+        }
 
-    const bool is_operation_succeed =
-        m_communication->read(configuration, buffer.data(), buffer.size());
+        m_communication->close();
+    }
 
-    m_communication->close();
+    lock.unlock();
 
-    if (!is_operation_succeed)
+    if (is_recording)
     {
-        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: failed reading the status!", this->to_string());
-        return false;
+        record.is_successful = is_operation_succeed;
+        record.duration_usec = recorder.elapsed_usec() - record.timestamp_usec;
+
+        if (type == io_trace_record_type::USB_CONTROL_READ && is_operation_succeed)
+        {
+            record.response_data.assign(reinterpret_cast<const char *>(data), size);
+        }
+
+        recorder.record(record);
     }
 
-    return bool(1 & buffer[1]);
+    return is_operation_succeed;
 }
@@ -14,17 +14,60 @@ public:
     energenie_eg_base();
 
     auto initialize(std::shared_ptr<kommpot::device_communication> communication) -> bool override;
+    auto initialize(std::shared_ptr<io_trace_replay> replay,
+        const sokketter::power_strip_configuration &configuration) -> bool override;
 
     [[nodiscard]] auto try_authenticate() -> bool override;
 
 protected:
+    /**
+     * @brief serializes the transfers of all USB power strips, held for a single attempt.
+     */
     static std::mutex m_usb_communication_mutex;
 
     std::string m_serial_number = "";
+
+    /**
+     * @brief key of the USB topology entry in the serial number cache, empty if not cached.
+     */
+    std::string m_serial_cache_key = "";
     size_t m_socket_number = 0;
 
     virtual auto power_socket(size_t index, bool is_toggled) -> bool;
     virtual auto socket_status(size_t index) -> bool;
+
+    auto read_socket_state(size_t index, bool &is_powered_on) -> bool override;
+
+    /**
+     * @brief opens the communication, performs a control transfer reading from the device and
+     * closes the communication again, or serves the transfer from the replayed trace.
+     */
+    auto control_read(
+        const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+        -> bool;
+
+    /**
+     * @brief opens the communication, performs a control transfer writing to the device and
+     * closes the communication again, or serves the transfer from the replayed trace.
+     */
+    auto control_write(
+        const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+        -> bool;
+
+private:
+    /**
+     * @brief runs the transfer according to settings_structure::usb_retry_policy.
+     */
+    auto control_transfer(const io_trace_record_type &type,
+        const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+        -> bool;
+
+    /**
+     * @attention every attempt is recorded on its own, so replaying the trace repeats the retries.
+     */
+    auto control_transfer_attempt(const io_trace_record_type &type,
+        const kommpot::control_transfer_configuration &configuration, uint8_t *data, size_t size)
+        -> bool;
 };
 
 #endif // ENERGENIE_EG_BASE_H
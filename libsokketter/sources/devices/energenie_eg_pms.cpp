@@ -20,7 +20,8 @@ energenie_eg_pms::energenie_eg_pms()
         sokketter::socket socket(socket_index,
             std::bind(&energenie_eg_pms::power_socket, this, std::placeholders::_1,
                 std::placeholders::_2),
-            std::bind(&energenie_eg_pms::socket_status, this, std::placeholders::_1));
+            std::bind(&energenie_eg_pms::socket_status, this, std::placeholders::_1),
+            std::bind(&energenie_eg_pms::cached_socket_state, this, std::placeholders::_1));
         m_sockets.push_back(socket);
     }
 }
@@ -20,7 +20,8 @@ energenie_eg_pms2::energenie_eg_pms2()
         sokketter::socket socket(socket_index,
             std::bind(&energenie_eg_pms2::power_socket, this, std::placeholders::_1,
                 std::placeholders::_2),
-            std::bind(&energenie_eg_pms2::socket_status, this, std::placeholders::_1));
+            std::bind(&energenie_eg_pms2::socket_status, this, std::placeholders::_1),
+            std::bind(&energenie_eg_pms2::cached_socket_state, this, std::placeholders::_1));
         m_sockets.push_back(socket);
     }
 }
@@ -1,9 +1,13 @@
 #include "energenie_eg_pmxx_lan.h"
 
+#include <call_context.h>
 #include <curl/curl.h>
 
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 energenie_eg_pmxx_lan::energenie_eg_pmxx_lan()
@@ -24,7 +28,8 @@ energenie_eg_pmxx_lan::energenie_eg_pmxx_lan()
         sokketter::socket socket(socket_index,
             std::bind(&energenie_eg_pmxx_lan::power_socket, this, std::placeholders::_1,
                 std::placeholders::_2),
-            std::bind(&energenie_eg_pmxx_lan::socket_status, this, std::placeholders::_1));
+            std::bind(&energenie_eg_pmxx_lan::socket_status, this, std::placeholders::_1),
+            std::bind(&energenie_eg_pmxx_lan::cached_socket_state, this, std::placeholders::_1));
         m_sockets.push_back(socket);
     }
 }
@@ -67,10 +72,35 @@ auto energenie_eg_pmxx_lan::initialize(std::shared_ptr<kommpot::device_communica
     return true;
 }
 
+auto energenie_eg_pmxx_lan::initialize(std::shared_ptr<io_trace_replay> replay,
+    const sokketter::power_strip_configuration &configuration) -> bool
+{
+    if (!energenie_eg_base::initialize(replay, configuration))
+    {
+        return false;
+    }
+
+    /**
+     * @attention replayed exchanges never reach a device and the trace does not store passwords,
+     * so a placeholder satisfies the password checks of the driver.
+     */
+    m_configuration.authentication.password = "replay";
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: initialization from I/O trace.", this->to_string());
+
+    return true;
+}
+
 auto energenie_eg_pmxx_lan::try_authenticate() -> bool
 {
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: trying to authenticate.", this->to_string());
 
+    /**
+     * @attention the power strip allows a single session, so the login must not overlap with
+     * switching or a background status read.
+     */
+    const std::lock_guard<std::mutex> lock(m_io_mutex);
+
     const std::string &address = this->configuration().address;
 
     CURL *curl = create_session();
@@ -81,12 +111,9 @@ auto energenie_eg_pmxx_lan::try_authenticate() -> bool
         return false;
     }
 
-    std::string response = "";
-    const bool is_logged_in =
-        login(curl, address, m_configuration.authentication.password, response);
-
-    SPDLOG_LOGGER_DEBUG(
-        SOKKETTER_LOGGER, "{}: received response: {}.", this->to_string(), response);
+    response_sink sink;
+    sink.is_ending_at_states = true;
+    const bool is_logged_in = login(curl, address, m_configuration.authentication.password, sink);
 
     logout(curl, address);
 
@@ -117,7 +144,9 @@ auto energenie_eg_pmxx_lan::identification() -> const kommpot::ethernet_device_i
 
 auto energenie_eg_pmxx_lan::power_socket(size_t index, bool is_toggled) -> bool
 {
-    if (m_communication == nullptr)
+    const std::lock_guard<std::mutex> lock(m_io_mutex);
+
+    if (!is_connected())
     {
         SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
             "{}: skipping powering socket due to disconnected status.", this->to_string(), index);
@@ -144,12 +173,13 @@ auto energenie_eg_pmxx_lan::power_socket(size_t index, bool is_toggled) -> bool
         return false;
     }
 
-    std::string response = "";
-    bool result = login(curl, address, m_configuration.authentication.password, response);
+    response_sink sink;
+    sink.is_ending_at_states = true;
+    bool result = login(curl, address, m_configuration.authentication.password, sink);
     if (result)
     {
         const std::string fields = "cte" + std::to_string(index) + "=" + (is_toggled ? "1" : "0");
-        result = http_post(curl, "http://" + address + "/", fields, response);
+        result = http_post(curl, "http://" + address + "/", fields, sink);
     }
 
     logout(curl, address);
@@ -160,60 +190,142 @@ auto energenie_eg_pmxx_lan::power_socket(size_t index, bool is_toggled) -> bool
     {
         SPDLOG_LOGGER_ERROR(
             SOKKETTER_LOGGER, "{}: failed powering socket {}.", this->to_string(), index);
+        m_socket_states.invalidate();
         return false;
     }
 
     /**
      * The device echoes the full socket states in its response, so refresh the cache from it and
-     * avoid a follow-up status query. Fall back to the requested state if parsing yields nothing.
+     * avoid a follow-up status query. Fall back to the requested state if it contains none.
      */
-    if (!update_states_from_response(response) && index >= 1 && index <= m_socket_states.size())
+    std::vector<bool> states;
+    if (!update_states_from_response(sink, states))
     {
-        m_socket_states[index - 1] = is_toggled;
-        m_socket_states_time = std::chrono::steady_clock::now();
+        m_socket_states.store(index, is_toggled);
     }
 
     return true;
 }
 
-auto energenie_eg_pmxx_lan::socket_status(size_t index) -> bool
+auto energenie_eg_pmxx_lan::power_sockets(const std::map<size_t, bool> &states)
+    -> std::vector<size_t>
 {
-    if (m_communication == nullptr)
+    const std::lock_guard<std::mutex> lock(m_io_mutex);
+
+    if (states.empty())
+    {
+        return {};
+    }
+
+    if (!is_connected())
     {
         SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
-            "{}: skipping checking socket status due to disconnected status.", this->to_string(),
-            index);
-        return false;
+            "{}: skipping powering sockets due to disconnected status.", this->to_string());
+        return {};
+    }
+
+    if (m_configuration.authentication.password.empty())
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "{}: no password provided for powering sockets.", this->to_string());
+        return {};
+    }
+
+    /**
+     * The socket list holds the sockets in order, so the device socket index is one above the
+     * list index.
+     */
+    std::string fields;
+    std::vector<size_t> indices;
+    for (const auto &[index, on] : states)
+    {
+        if (index >= m_sockets.size())
+        {
+            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: index {} is out of range 0-{}!",
+                this->to_string(), index, m_sockets.size());
+            continue;
+        }
+
+        fields += (fields.empty() ? "cte" : "&cte") + std::to_string(index + 1) + "=" +
+                  (on ? "1" : "0");
+        indices.push_back(index);
     }
 
-    const bool cache_fresh =
-        m_socket_states_valid &&
-        (std::chrono::steady_clock::now() - m_socket_states_time) < SOCKET_STATES_CACHE_TTL;
+    if (indices.empty())
+    {
+        return {};
+    }
+
+    SPDLOG_LOGGER_DEBUG(
+        SOKKETTER_LOGGER, "{}: powering sockets with {}.", this->to_string(), fields);
 
-    if (!cache_fresh)
+    const std::string &address = this->configuration().address;
+
+    CURL *curl = create_session();
+    if (curl == nullptr)
     {
-        SPDLOG_LOGGER_DEBUG(
-            SOKKETTER_LOGGER, "{}: checking socket {} status.", this->to_string(), index);
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "{}: failed to initialize the HTTP session.", this->to_string());
+        return {};
+    }
+
+    response_sink sink;
+    sink.is_ending_at_states = true;
+    bool result = login(curl, address, m_configuration.authentication.password, sink);
+    if (result)
+    {
+        result = http_post(curl, "http://" + address + "/", fields, sink);
+    }
+
+    logout(curl, address);
+
+    curl_easy_cleanup(curl);
+
+    if (!result)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: failed powering sockets.", this->to_string());
+        m_socket_states.invalidate();
+        return {};
+    }
 
-        if (!refresh_socket_states())
+    std::vector<bool> response_states;
+    if (!update_states_from_response(sink, response_states))
+    {
+        for (const auto &index : indices)
         {
-            SPDLOG_LOGGER_ERROR(
-                SOKKETTER_LOGGER, "{}: failed reading socket {} status.", this->to_string(), index);
-            return false;
+            m_socket_states.store(index + 1, states.at(index));
         }
     }
 
-    if (index < 1 || index > m_socket_states.size())
+    return indices;
+}
+
+auto energenie_eg_pmxx_lan::read_socket_state(size_t index, bool &is_powered_on) -> bool
+{
+    SPDLOG_LOGGER_DEBUG(
+        SOKKETTER_LOGGER, "{}: checking socket {} status.", this->to_string(), index);
+
+    std::vector<bool> states;
+    if (!refresh_socket_states(states))
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "{}: failed reading socket {} status.", this->to_string(), index);
+        return false;
+    }
+
+    if (index < 1 || index > states.size())
     {
         SPDLOG_LOGGER_ERROR(
             SOKKETTER_LOGGER, "{}: socket {} status is not available.", this->to_string(), index);
         return false;
     }
 
-    return m_socket_states[index - 1];
+    is_powered_on = states[index - 1];
+
+    return true;
 }
 
-auto energenie_eg_pmxx_lan::refresh_socket_states() -> bool
+auto energenie_eg_pmxx_lan::refresh_socket_states(std::vector<bool> &states) -> bool
 {
     if (m_configuration.authentication.password.empty())
     {
@@ -232,9 +344,22 @@ auto energenie_eg_pmxx_lan::refresh_socket_states() -> bool
         return false;
     }
 
-    std::string response = "";
-    const bool is_logged_in =
-        login(curl, address, m_configuration.authentication.password, response);
+    response_sink sink;
+    sink.is_ending_at_states = true;
+    bool is_logged_in = false;
+
+    std::chrono::microseconds hedging_delay{0};
+    if (m_replay == nullptr &&
+        sokketter_core::instance().is_ethernet_status_hedging_enabled() &&
+        m_post_latency.percentile(HTTP_HEDGING_PERCENTILE, hedging_delay))
+    {
+        is_logged_in = hedged_login(
+            curl, address, m_configuration.authentication.password, hedging_delay, sink);
+    }
+    else
+    {
+        is_logged_in = login(curl, address, m_configuration.authentication.password, sink);
+    }
 
     logout(curl, address);
 
@@ -245,20 +370,19 @@ auto energenie_eg_pmxx_lan::refresh_socket_states() -> bool
         return false;
     }
 
-    return update_states_from_response(response);
+    return update_states_from_response(sink, states);
 }
 
-auto energenie_eg_pmxx_lan::update_states_from_response(const std::string &body) -> bool
+auto energenie_eg_pmxx_lan::update_states_from_response(
+    const response_sink &sink, std::vector<bool> &states) -> bool
 {
-    const std::vector<bool> states = parse_socket_states(body);
-    if (states.empty())
+    if (!sink.scanner.is_complete() || sink.scanner.states().empty())
     {
         return false;
     }
 
-    m_socket_states = states;
-    m_socket_states_time = std::chrono::steady_clock::now();
-    m_socket_states_valid = true;
+    states = sink.scanner.states();
+    m_socket_states.store(states);
 
     return true;
 }
@@ -267,121 +391,421 @@ auto energenie_eg_pmxx_lan::write_callback(char *data, size_t size, size_t count
     -> size_t
 {
     const size_t length = size * count;
-    auto *buffer = static_cast<std::string *>(user_data);
-    buffer->append(data, length);
+    auto *sink = static_cast<response_sink *>(user_data);
+
+    if (sink->feed(std::string_view(data, length)) && sink->is_ending_at_states)
+    {
+        /**
+         * @attention the embedded web server is slow to send the rest of the page, so the transfer
+         * is ended as soon as the socket states arrived by taking none of the received bytes.
+         */
+        return 0;
+    }
+
     return length;
 }
 
+auto energenie_eg_pmxx_lan::response_sink::feed(std::string_view chunk) -> bool
+{
+    if (is_keeping_body)
+    {
+        body.append(chunk);
+    }
+
+    if (!is_login_form_found)
+    {
+        tail.append(chunk);
+        is_login_form_found = tail.find(LOGIN_FORM_MARKER) != std::string::npos;
+
+        const size_t kept_length = LOGIN_FORM_MARKER.size() - 1;
+        if (tail.size() > kept_length)
+        {
+            tail.erase(0, tail.size() - kept_length);
+        }
+    }
+
+    return scanner.feed(chunk);
+}
+
+auto energenie_eg_pmxx_lan::response_sink::reset() -> void
+{
+    scanner.reset();
+    is_login_form_found = false;
+    tail.clear();
+    is_keeping_body = sokketter_core::instance().io_trace().is_recording();
+    body.clear();
+}
+
+auto energenie_eg_pmxx_lan::is_transfer_successful(
+    const CURLcode &result, const response_sink &sink) -> bool
+{
+    return result == CURLE_OK || (result == CURLE_WRITE_ERROR && sink.scanner.is_complete());
+}
+
 auto energenie_eg_pmxx_lan::http_post(
-    CURL *curl, const std::string &url, const std::string &fields, std::string &response) -> bool
+    CURL *curl, const std::string &url, const std::string &fields, response_sink &sink) -> bool
+{
+    return transfer_policy::retry(sokketter_core::instance().ethernet_retry_policy(),
+        this->to_string(), [&]() { return http_post_attempt(curl, url, fields, sink); });
+}
+
+auto energenie_eg_pmxx_lan::http_post_attempt(
+    CURL *curl, const std::string &url, const std::string &fields, response_sink &sink) -> bool
 {
-    response.clear();
+    sink.reset();
+
+    if (m_replay != nullptr)
+    {
+        return replay_exchange(io_trace_record_type::HTTP_POST, sink);
+    }
 
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_POSTFIELDS, fields.c_str());
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &sink);
+    apply_call_limits(curl);
+
+    const uint64_t timestamp_usec = sokketter_core::instance().io_trace().elapsed_usec();
 
     const auto result = curl_easy_perform(curl);
-    if (result != CURLE_OK)
+    const bool is_successful = is_transfer_successful(result, sink);
+
+    record_exchange(
+        io_trace_record_type::HTTP_POST, timestamp_usec, url, fields, sink.body, is_successful);
+
+    if (!is_successful)
     {
         SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: HTTP POST request failed: {}.",
             this->to_string(), curl_easy_strerror(result));
         return false;
     }
 
+    m_post_latency.record(std::chrono::microseconds(
+        sokketter_core::instance().io_trace().elapsed_usec() - timestamp_usec));
+
     return true;
 }
 
-auto energenie_eg_pmxx_lan::http_get(CURL *curl, const std::string &url, std::string &response)
+auto energenie_eg_pmxx_lan::hedged_login(CURL *&curl, const std::string &address,
+    const std::string &password, const std::chrono::microseconds &delay, response_sink &sink)
     -> bool
 {
-    response.clear();
+    const std::string url = "http://" + address + "/login.html";
+    const std::string fields = "pw=" + password;
 
-    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+    const bool response_received = transfer_policy::retry(
+        sokketter_core::instance().ethernet_retry_policy(), this->to_string(),
+        [&]() { return hedged_post_attempt(curl, address, url, fields, delay, sink); });
+    if (!response_received)
+    {
+        return false;
+    }
 
-    return curl_easy_perform(curl) == CURLE_OK;
+    return !sink.is_login_form_found;
 }
 
-auto energenie_eg_pmxx_lan::create_session() -> CURL *
+auto energenie_eg_pmxx_lan::hedged_post_attempt(CURL *&curl, const std::string &address,
+    const std::string &url, const std::string &fields, const std::chrono::microseconds &delay,
+    response_sink &sink) -> bool
 {
-    CURL *curl = curl_easy_init();
-    if (curl == nullptr)
+    struct exchange
     {
-        return nullptr;
+        CURL *curl = nullptr;
+        response_sink sink;
+        uint64_t timestamp_usec = 0;
+        bool is_finished = false;
+    };
+
+    auto &recorder = sokketter_core::instance().io_trace();
+
+    CURLM *multi = curl_multi_init();
+    if (multi == nullptr)
+    {
+        return http_post_attempt(curl, url, fields, sink);
     }
 
-    curl_easy_setopt(curl, CURLOPT_COOKIEFILE, "");
-    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, HTTP_TIMEOUT_SECONDS);
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, HTTP_TIMEOUT_SECONDS);
+    std::array<exchange, 2> exchanges;
+    exchanges[0].curl = curl;
+    size_t started_exchanges = 0;
 
-    return curl;
-}
+    const auto start_exchange = [&](exchange &entry) {
+        curl_easy_setopt(entry.curl, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(entry.curl, CURLOPT_POSTFIELDS, fields.c_str());
+        entry.sink.is_ending_at_states = sink.is_ending_at_states;
+        entry.sink.reset();
 
-auto energenie_eg_pmxx_lan::login(CURL *curl, const std::string &address,
-    const std::string &password, std::string &response) -> bool
-{
-    const bool response_received =
-        http_post(curl, "http://" + address + "/login.html", "pw=" + password, response);
-    if (!response_received)
+        curl_easy_setopt(entry.curl, CURLOPT_WRITEFUNCTION, write_callback);
+        curl_easy_setopt(entry.curl, CURLOPT_WRITEDATA, &entry.sink);
+        apply_call_limits(entry.curl);
+        entry.timestamp_usec = recorder.elapsed_usec();
+        curl_multi_add_handle(multi, entry.curl);
+        started_exchanges++;
+    };
+
+    start_exchange(exchanges[0]);
+
+    const auto hedging_time = std::chrono::steady_clock::now() + delay;
+    exchange *winner = nullptr;
+
+    while (winner == nullptr)
     {
-        return false;
+        int running_exchanges = 0;
+        curl_multi_perform(multi, &running_exchanges);
+
+        int queued_messages = 0;
+        while (CURLMsg *message = curl_multi_info_read(multi, &queued_messages))
+        {
+            if (message->msg != CURLMSG_DONE)
+            {
+                continue;
+            }
+
+            for (size_t index = 0; index < started_exchanges; index++)
+            {
+                auto &entry = exchanges[index];
+                if (entry.curl != message->easy_handle)
+                {
+                    continue;
+                }
+
+                entry.is_finished = true;
+                if (is_transfer_successful(message->data.result, entry.sink) &&
+                    winner == nullptr)
+                {
+                    winner = &entry;
+                }
+            }
+        }
+
+        if (winner != nullptr)
+        {
+            break;
+        }
+
+        const bool is_hedge_started = started_exchanges == exchanges.size();
+        const bool is_first_failed = exchanges[0].is_finished;
+        if (!is_hedge_started && is_first_failed && call_context::is_expired())
+        {
+            break;
+        }
+
+        if (!is_hedge_started &&
+            (is_first_failed || std::chrono::steady_clock::now() >= hedging_time))
+        {
+            exchanges[1].curl = create_session();
+            if (exchanges[1].curl == nullptr)
+            {
+                if (is_first_failed)
+                {
+                    break;
+                }
+
+                /**
+                 * @attention the hedge cannot be sent, so wait for the first request alone.
+                 */
+                exchanges[1].is_finished = true;
+                started_exchanges = exchanges.size();
+                continue;
+            }
+
+            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+                "{}: no response within {} us, sending a hedged status request.",
+                this->to_string(), delay.count());
+
+            start_exchange(exchanges[1]);
+            continue;
+        }
+
+        if (is_hedge_started && exchanges[0].is_finished && exchanges[1].is_finished)
+        {
+            break;
+        }
+
+        int timeout_msec = 100;
+        if (!is_hedge_started)
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                hedging_time - std::chrono::steady_clock::now());
+            timeout_msec = static_cast<int>(std::clamp<int64_t>(remaining.count(), 1, 100));
+        }
+
+        curl_multi_wait(multi, nullptr, 0, timeout_msec, nullptr);
     }
 
-    const std::string marker = "action=\"/login.html\"";
-    const auto marker_position = response.find(marker);
-    if (marker_position != std::string::npos)
+    for (size_t index = 0; index < started_exchanges; index++)
     {
-        /**
-         * Authentication failed if login form is present in the response.
-         */
+        auto &entry = exchanges[index];
+        if (entry.curl == nullptr)
+        {
+            continue;
+        }
+
+        curl_multi_remove_handle(multi, entry.curl);
+    }
+
+    curl_multi_cleanup(multi);
+
+    /**
+     * @attention the session answering first is kept for switching and logging out, the other
+     * one is aborted and logged out, as the power strip may have accepted its login as well.
+     */
+    if (winner != nullptr && winner != &exchanges[0])
+    {
+        std::swap(exchanges[0].curl, exchanges[1].curl);
+        std::swap(exchanges[0].sink, exchanges[1].sink);
+        std::swap(exchanges[0].timestamp_usec, exchanges[1].timestamp_usec);
+        winner = &exchanges[0];
+        curl = winner->curl;
+    }
+
+    if (exchanges[1].curl != nullptr)
+    {
+        logout(exchanges[1].curl, address);
+        curl_easy_cleanup(exchanges[1].curl);
+    }
+
+    const uint64_t timestamp_usec = exchanges[0].timestamp_usec;
+    sink = std::move(exchanges[0].sink);
+
+    record_exchange(io_trace_record_type::HTTP_POST, timestamp_usec, url, fields, sink.body,
+        winner != nullptr);
+
+    if (winner == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "{}: hedged HTTP POST request failed.", this->to_string());
         return false;
     }
 
+    m_post_latency.record(std::chrono::microseconds(recorder.elapsed_usec() - timestamp_usec));
+
     return true;
 }
 
-auto energenie_eg_pmxx_lan::logout(CURL *curl, const std::string &address) -> void
+auto energenie_eg_pmxx_lan::http_get(CURL *curl, const std::string &url, response_sink &sink)
+    -> bool
 {
-    std::string response = "";
-    http_get(curl, "http://" + address + "/login.html", response);
+    sink.reset();
+
+    if (m_replay != nullptr)
+    {
+        return replay_exchange(io_trace_record_type::HTTP_GET, sink);
+    }
+
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &sink);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, HTTP_LOGOUT_TIMEOUT_MSEC);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, HTTP_LOGOUT_TIMEOUT_MSEC);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 1L);
+
+    const uint64_t timestamp_usec = sokketter_core::instance().io_trace().elapsed_usec();
+
+    const bool is_successful = curl_easy_perform(curl) == CURLE_OK;
+
+    record_exchange(
+        io_trace_record_type::HTTP_GET, timestamp_usec, url, "", sink.body, is_successful);
+
+    return is_successful;
 }
 
-auto energenie_eg_pmxx_lan::parse_socket_states(const std::string &body) -> std::vector<bool>
+auto energenie_eg_pmxx_lan::replay_exchange(const io_trace_record_type &type, response_sink &sink)
+    -> bool
 {
-    std::vector<bool> states;
+    const auto &record = m_replay->next(m_serial_number, type);
+    if (!record.has_value())
+    {
+        return false;
+    }
+
+    sink.feed(record->response_data);
+
+    return record->is_successful;
+}
 
-    const std::string marker = "sockstates = ";
-    const auto marker_position = body.find(marker);
-    if (marker_position == std::string::npos)
+auto energenie_eg_pmxx_lan::record_exchange(const io_trace_record_type &type,
+    const uint64_t &timestamp_usec, const std::string &url, const std::string &fields,
+    const std::string &response, const bool &is_successful) -> void
+{
+    auto &recorder = sokketter_core::instance().io_trace();
+    if (!recorder.is_recording())
     {
-        return states;
+        return;
     }
 
-    const auto open_bracket = body.find('[', marker_position);
-    const auto close_bracket = body.find(']', open_bracket);
-    if (open_bracket == std::string::npos || close_bracket == std::string::npos)
+    io_trace_record record;
+    record.type = type;
+    record.is_successful = is_successful;
+    record.timestamp_usec = timestamp_usec;
+    record.duration_usec = recorder.elapsed_usec() - timestamp_usec;
+    record.device_id = m_serial_number;
+    record.request_data = url;
+    record.response_data = response;
+
+    if (!fields.empty())
     {
-        return states;
+        const std::string password_field = "pw=";
+        record.request_data +=
+            "\n" + (fields.rfind(password_field, 0) == 0 ? password_field + "***" : fields);
     }
 
-    const std::string list = body.substr(open_bracket + 1, close_bracket - open_bracket - 1);
+    recorder.record(record);
+}
 
-    std::istringstream stream(list);
-    std::string token;
-    while (std::getline(stream, token, ','))
+auto energenie_eg_pmxx_lan::create_session() -> CURL *
+{
+    CURL *curl = curl_easy_init();
+    if (curl == nullptr)
     {
-        const auto first = token.find_first_not_of(" \t\r\n");
-        if (first == std::string::npos)
-        {
-            continue;
-        }
-        const auto last = token.find_last_not_of(" \t\r\n");
-        states.push_back(token.substr(first, last - first + 1) == "1");
+        return nullptr;
     }
 
-    return states;
+    curl_easy_setopt(curl, CURLOPT_COOKIEFILE, "");
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, HTTP_TIMEOUT_SECONDS);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, HTTP_TIMEOUT_SECONDS);
+
+    return curl;
+}
+
+auto energenie_eg_pmxx_lan::apply_call_limits(CURL *curl) -> void
+{
+    const auto timeout = call_context::remaining(std::chrono::seconds(HTTP_TIMEOUT_SECONDS));
+
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(timeout.count()));
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(timeout.count()));
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, progress_callback);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+}
+
+auto energenie_eg_pmxx_lan::progress_callback(
+    void *, curl_off_t, curl_off_t, curl_off_t, curl_off_t) -> int
+{
+    /**
+     * @attention curl calls back on the thread performing the transfer, so the call options of
+     * that thread apply.
+     */
+    return call_context::is_expired() ? 1 : 0;
+}
+
+auto energenie_eg_pmxx_lan::login(CURL *curl, const std::string &address,
+    const std::string &password, response_sink &sink) -> bool
+{
+    const bool response_received =
+        http_post(curl, "http://" + address + "/login.html", "pw=" + password, sink);
+    if (!response_received)
+    {
+        return false;
+    }
+
+    /**
+     * Authentication failed if login form is present in the response.
+     */
+    return !sink.is_login_form_found;
+}
+
+auto energenie_eg_pmxx_lan::logout(CURL *curl, const std::string &address) -> void
+{
+    response_sink sink;
+    http_get(curl, "http://" + address + "/login.html", sink);
 }
@@ -4,13 +4,17 @@
 #pragma once
 
 #include <devices/energenie_eg_base.h>
+#include <sockstates_scanner.h>
 #include <sokketter_core.h>
+#include <transfer_policy.h>
 
 #include <curl/curl.h>
 #include <spdlog/spdlog.h>
 
 #include <chrono>
+#include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class energenie_eg_pmxx_lan : public energenie_eg_base
@@ -20,9 +24,17 @@ public:
     ~energenie_eg_pmxx_lan();
 
     auto initialize(std::shared_ptr<kommpot::device_communication> communication) -> bool override;
+    auto initialize(std::shared_ptr<io_trace_replay> replay,
+        const sokketter::power_strip_configuration &configuration) -> bool override;
 
     [[nodiscard]] auto try_authenticate() -> bool override;
 
+    /**
+     * @brief switches all requested sockets with a single login and POST request.
+     */
+    [[nodiscard]] auto power_sockets(const std::map<size_t, bool> &states)
+        -> std::vector<size_t> override;
+
     static auto identification() -> const kommpot::ethernet_device_identification;
 
 private:
@@ -32,35 +44,129 @@ private:
     static constexpr long HTTP_TIMEOUT_SECONDS = 5;
 
     /**
-     * @brief how long cached socket states stay valid before another status query is issued.
-     *
-     * A single status query returns the states of every socket, so a short cache collapses the
-     * burst of per-socket reads done when a device page is opened into one network round-trip.
+     * @brief maximum time in milliseconds allowed for logging out, see http_get().
+     */
+    static constexpr long HTTP_LOGOUT_TIMEOUT_MSEC = 1000;
+
+    /**
+     * @brief share of the recent requests answered before a hedged status request is sent.
      */
-    static constexpr std::chrono::milliseconds SOCKET_STATES_CACHE_TTL{1000};
+    static constexpr double HTTP_HEDGING_PERCENTILE = 0.95;
 
-    std::vector<bool> m_socket_states;
-    std::chrono::steady_clock::time_point m_socket_states_time{};
-    bool m_socket_states_valid = false;
+    /**
+     * @brief durations of the recent successful POST requests, used as the hedging delay.
+     */
+    latency_tracker m_post_latency;
 
     auto power_socket(size_t index, bool is_toggled) -> bool override;
-    auto socket_status(size_t index) -> bool override;
+    auto read_socket_state(size_t index, bool &is_powered_on) -> bool override;
+
+    /**
+     * @brief marks the login form, which the power strip sends again if the password was rejected.
+     */
+    inline static constexpr std::string_view LOGIN_FORM_MARKER = "action=\"/login.html\"";
+
+    /**
+     * @brief receives a response body chunk by chunk, reading the socket states and the login
+     * result from it without buffering the page.
+     */
+    struct response_sink
+    {
+        sockstates_scanner scanner;
+
+        /**
+         * @brief ends the transfer once the socket states were read, the rest of the page is
+         * never used.
+         */
+        bool is_ending_at_states = false;
+
+        /**
+         * @brief set once the login form was received, i.e. the login was not accepted.
+         */
+        bool is_login_form_found = false;
+
+        /**
+         * @brief the last received bytes, to find the login form marker split across chunks.
+         */
+        std::string tail = "";
+
+        /**
+         * @brief the whole body, kept only while the I/O trace is recording.
+         */
+        bool is_keeping_body = false;
+        std::string body = "";
+
+        /**
+         * @brief takes the next chunk of the body.
+         * @return true once the socket states were read, false otherwise.
+         */
+        auto feed(std::string_view chunk) -> bool;
+
+        /**
+         * @brief prepares the sink for the next attempt, keeping is_ending_at_states.
+         */
+        auto reset() -> void;
+    };
 
     static auto write_callback(char *data, size_t size, size_t count, void *user_data) -> size_t;
+
+    /**
+     * @brief checks the result of a transfer, treating one ended after the socket states as
+     * successful.
+     */
+    static auto is_transfer_successful(const CURLcode &result, const response_sink &sink) -> bool;
+
+    /**
+     * @brief sends the POST request according to settings_structure::ethernet_retry_policy.
+     */
     auto http_post(CURL *curl, const std::string &url, const std::string &fields,
-        std::string &response) -> bool;
-    auto http_get(CURL *curl, const std::string &url, std::string &response) -> bool;
+        response_sink &sink) -> bool;
+    auto http_post_attempt(CURL *curl, const std::string &url, const std::string &fields,
+        response_sink &sink) -> bool;
+
+    /**
+     * @brief sends the POST request and, if it is not answered within the delay, the same request
+     * from a second session, using the response received first.
+     * @param curl is replaced by the session answering first, the other one is logged out from
+     * the given address and cleaned up.
+     */
+    auto hedged_post_attempt(CURL *&curl, const std::string &address, const std::string &url,
+        const std::string &fields, const std::chrono::microseconds &delay, response_sink &sink)
+        -> bool;
+
+    /**
+     * @brief sends the GET request within HTTP_LOGOUT_TIMEOUT_MSEC, ignoring the deadline and the
+     * cancellation of the running call.
+     * @attention used for logging out only, which must still reach a power strip the call gave up
+     * on, as it keeps a single session and locks out other clients until it expires.
+     */
+    auto http_get(CURL *curl, const std::string &url, response_sink &sink) -> bool;
+
+    /**
+     * @brief serves an HTTP exchange from the replayed trace.
+     */
+    auto replay_exchange(const io_trace_record_type &type, response_sink &sink) -> bool;
+
+    /**
+     * @brief writes an HTTP exchange to the running I/O trace, with the login password redacted.
+     */
+    auto record_exchange(const io_trace_record_type &type, const uint64_t &timestamp_usec,
+        const std::string &url, const std::string &fields, const std::string &response,
+        const bool &is_successful) -> void;
 
     /**
      * @brief performs a single status query and refreshes the cached socket states.
+     * @param states receives the states of all sockets, the first state belongs to socket 1.
      */
-    auto refresh_socket_states() -> bool;
+    auto refresh_socket_states(std::vector<bool> &states) -> bool;
 
     /**
-     * @brief refreshes the cached socket states from a page containing the "sockstates" list.
+     * @brief refreshes the cached socket states from the "sockstates" list read by the sink.
+     * @attention a single status query returns the states of every socket, so the burst of
+     * per-socket reads done when a device page is opened costs one network round-trip.
      * @return true if states were found and cached, false otherwise.
      */
-    auto update_states_from_response(const std::string &body) -> bool;
+    auto update_states_from_response(const response_sink &sink, std::vector<bool> &states) -> bool;
 
     /**
      * @brief creates a new session handle with an in-memory cookie engine enabled.
@@ -70,15 +176,27 @@ private:
      */
     auto create_session() -> CURL *;
 
+    /**
+     * @brief limits the next request of the session to the deadline of the running call and
+     * aborts it once the call is cancelled, see sokketter::call_scope.
+     */
+    static auto apply_call_limits(CURL *curl) -> void;
+    static auto progress_callback(void *user_data, curl_off_t download_total,
+        curl_off_t download_now, curl_off_t upload_total, curl_off_t upload_now) -> int;
+
+    /**
+     * @brief logs in, the status page answering an accepted login is read into the sink.
+     */
     auto login(CURL *curl, const std::string &address, const std::string &password,
-        std::string &response) -> bool;
-    auto logout(CURL *curl, const std::string &address) -> void;
+        response_sink &sink) -> bool;
 
     /**
-     * @brief extracts the socket states from the "sockstates = [x,x,x,x]" declaration of the status
-     * page.
+     * @brief logs in like login(), but hedges the request after the given delay.
+     * @attention used for status reads only, switching is never sent twice.
      */
-    static auto parse_socket_states(const std::string &body) -> std::vector<bool>;
+    auto hedged_login(CURL *&curl, const std::string &address, const std::string &password,
+        const std::chrono::microseconds &delay, response_sink &sink) -> bool;
+    auto logout(CURL *curl, const std::string &address) -> void;
 };
 
 #endif // ENERGENIE_EG_PMXX_LAN_H
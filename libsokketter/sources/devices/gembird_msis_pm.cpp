@@ -20,7 +20,8 @@ gembird_msis_pm::gembird_msis_pm()
         sokketter::socket socket(socket_index,
             std::bind(
                 &gembird_msis_pm::power_socket, this, std::placeholders::_1, std::placeholders::_2),
-            std::bind(&gembird_msis_pm::socket_status, this, std::placeholders::_1));
+            std::bind(&gembird_msis_pm::socket_status, this, std::placeholders::_1),
+            std::bind(&gembird_msis_pm::cached_socket_state, this, std::placeholders::_1));
         m_sockets.push_back(socket);
     }
 }
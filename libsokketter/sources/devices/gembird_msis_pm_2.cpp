@@ -20,7 +20,8 @@ gembird_msis_pm_2::gembird_msis_pm_2()
         sokketter::socket socket(socket_index,
             std::bind(&gembird_msis_pm_2::power_socket, this, std::placeholders::_1,
                 std::placeholders::_2),
-            std::bind(&gembird_msis_pm_2::socket_status, this, std::placeholders::_1));
+            std::bind(&gembird_msis_pm_2::socket_status, this, std::placeholders::_1),
+            std::bind(&gembird_msis_pm_2::cached_socket_state, this, std::placeholders::_1));
         m_sockets.push_back(socket);
     }
 }
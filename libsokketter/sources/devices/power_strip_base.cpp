@@ -15,6 +15,33 @@ bool power_strip_base::initialize(std::shared_ptr<kommpot::device_communication>
     return true;
 }
 
+bool power_strip_base::initialize(std::shared_ptr<io_trace_replay> replay,
+    const sokketter::power_strip_configuration &configuration)
+{
+    if (replay == nullptr)
+    {
+        return false;
+    }
+
+    m_replay = replay;
+
+    auto replay_configuration = m_configuration;
+    replay_configuration.id = configuration.id;
+    replay_configuration.name = configuration.name;
+    replay_configuration.address = configuration.address;
+    configure(replay_configuration);
+
+    return true;
+}
+
+auto power_strip_base::reconnect(std::shared_ptr<kommpot::device_communication> communication)
+    -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_io_mutex);
+
+    return initialize(communication);
+}
+
 bool power_strip_base::copyFrom(const power_strip &other)
 {
     /**
@@ -43,6 +70,11 @@ bool power_strip_base::copyFrom(const power_strip &other)
     return true;
 }
 
+auto power_strip_base::set_registered(const bool &is_registered) -> void
+{
+    m_configuration.is_registered = is_registered;
+}
+
 auto power_strip_base::socket(const size_t &index)
     -> const std::optional<std::reference_wrapper<sokketter::socket>>
 {
@@ -58,5 +90,116 @@ auto power_strip_base::socket(const size_t &index)
 
 auto power_strip_base::is_connected() const -> bool
 {
-    return m_communication != nullptr;
+    return m_communication != nullptr || m_replay != nullptr;
+}
+
+auto power_strip_base::invalidate_socket_states() -> void
+{
+    m_socket_states.invalidate();
+}
+
+auto power_strip_base::last_known_socket_states() const -> std::vector<sokketter::socket_state>
+{
+    std::vector<sokketter::socket_state> states(m_sockets.size());
+
+    for (size_t index = 0; index < states.size(); ++index)
+    {
+        states[index].is_valid = m_socket_states.last_known(index + 1, states[index].is_powered_on);
+    }
+
+    return states;
+}
+
+auto power_strip_base::restore_last_known_socket_states(
+    const std::vector<sokketter::socket_state> &states) -> void
+{
+    std::map<size_t, bool> last_known;
+
+    for (size_t index = 0; index < states.size(); ++index)
+    {
+        if (states[index].is_valid)
+        {
+            last_known[index + 1] = states[index].is_powered_on;
+        }
+    }
+
+    m_socket_states.restore_last_known(last_known);
+}
+
+auto power_strip_base::cached_socket_state(size_t index) -> sokketter::socket_state
+{
+    sokketter::socket_state state;
+
+    if (!is_connected())
+    {
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+            "{}: skipping checking socket {} status due to disconnected status.",
+            this->to_string(), index);
+        return state;
+    }
+
+    switch (m_socket_states.find(m_configuration.id, index, state))
+    {
+    case socket_state_cache::lookup_result::FRESH: {
+        return state;
+    }
+    case socket_state_cache::lookup_result::STALE: {
+        refresh_socket_state_async(index);
+        return state;
+    }
+    default: {
+        break;
+    }
+    }
+
+    const std::lock_guard<std::mutex> lock(m_io_mutex);
+
+    state = {};
+    state.is_valid = read_socket_state(index, state.is_powered_on);
+
+    return state;
+}
+
+auto power_strip_base::read_socket_state(size_t index, bool &is_powered_on) -> bool
+{
+    return false;
+}
+
+auto power_strip_base::refresh_socket_state_async(size_t index) -> void
+{
+    if (!m_socket_states.begin_refresh())
+    {
+        return;
+    }
+
+    std::weak_ptr<power_strip_base> weak_self = weak_from_this();
+    if (weak_self.expired())
+    {
+        m_socket_states.end_refresh();
+        return;
+    }
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: refreshing socket {} status in the background.",
+        this->to_string(), index);
+
+    sokketter_core::instance().execute([weak_self, index]() {
+        const auto self = weak_self.lock();
+        if (self == nullptr)
+        {
+            return;
+        }
+
+        /**
+         * @attention a power strip busy with other I/O is refreshed by its next status read,
+         * waiting for it here would deadlock executors running the task inline.
+         */
+        std::unique_lock<std::mutex> lock(self->m_io_mutex, std::try_to_lock);
+        if (lock.owns_lock())
+        {
+            bool is_powered_on = false;
+            self->read_socket_state(index, is_powered_on);
+        }
+
+        self->m_socket_states.end_refresh();
+    });
 }
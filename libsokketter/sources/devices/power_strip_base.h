@@ -3,28 +3,89 @@
 
 #pragma once
 
+#include <io_trace.h>
 #include <libsokketter.h>
+#include <socket_state_cache.h>
 
 #include <third-party/kommpot/libkommpot/include/libkommpot.h>
 
+#include <memory>
+#include <mutex>
 #include <optional>
 
-class power_strip_base : public sokketter::power_strip
+class power_strip_base : public sokketter::power_strip,
+                         public std::enable_shared_from_this<power_strip_base>
 {
 public:
     power_strip_base() = default;
 
     virtual bool initialize(std::shared_ptr<kommpot::device_communication> communication);
 
+    /**
+     * @brief initializes the power strip to be driven from a recorded I/O trace.
+     * @param replay trace serving the recorded exchanges.
+     * @param configuration of the power strip as stored in the trace.
+     */
+    virtual bool initialize(std::shared_ptr<io_trace_replay> replay,
+        const sokketter::power_strip_configuration &configuration);
+
+    /**
+     * @brief initializes an already published power strip with a new communication.
+     * @attention older device list snapshots may still be driving the power strip, so it is
+     * initialized under m_io_mutex instead of being changed under a running transfer.
+     */
+    auto reconnect(std::shared_ptr<kommpot::device_communication> communication) -> bool;
+
     bool copyFrom(const sokketter::power_strip &other);
 
+    /**
+     * @brief sets sokketter::power_strip_configuration::is_registered, which configure() keeps.
+     */
+    auto set_registered(const bool &is_registered) -> void;
+
     [[nodiscard]] auto socket(const size_t &index)
         -> const std::optional<std::reference_wrapper<sokketter::socket>> override;
 
     [[nodiscard]] auto is_connected() const -> bool override;
 
+    auto invalidate_socket_states() -> void override;
+
+    [[nodiscard]] auto last_known_socket_states() const
+        -> std::vector<sokketter::socket_state> override;
+
+    /**
+     * @brief restores the last known socket states, the first state belongs to socket 1.
+     */
+    auto restore_last_known_socket_states(const std::vector<sokketter::socket_state> &states)
+        -> void;
+
 protected:
     std::shared_ptr<kommpot::device_communication> m_communication = nullptr;
+    std::shared_ptr<io_trace_replay> m_replay = nullptr;
+
+    socket_state_cache m_socket_states;
+
+    /**
+     * @brief serializes the I/O with the power strip, taken by the synchronous calls as well as
+     * by the background refreshes, as the drivers are not safe for concurrent use.
+     */
+    std::mutex m_io_mutex;
+
+    /**
+     * @brief serves the socket state from the cache or reads it from the power strip, stale
+     * states are returned right away and read again in the background.
+     */
+    auto cached_socket_state(size_t index) -> sokketter::socket_state;
+
+    /**
+     * @brief reads the socket state from the connected power strip and stores it in the cache.
+     * @attention called with m_io_mutex held.
+     * @return true in case of success, false in case of any failure.
+     */
+    virtual auto read_socket_state(size_t index, bool &is_powered_on) -> bool;
+
+private:
+    auto refresh_socket_state_async(size_t index) -> void;
 };
 
 #endif // POWER_STRIP_BASE_H
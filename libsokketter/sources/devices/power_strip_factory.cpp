@@ -6,6 +6,7 @@
 #include <devices/gembird_msis_pm.h>
 #include <devices/gembird_msis_pm_2.h>
 #include <devices/gembird_sis_pm.h>
+#include <devices/power_strip_base.h>
 #include <sokketter_core.h>
 #include <spdlog/spdlog.h>
 
@@ -188,3 +189,24 @@ std::shared_ptr<sokketter::power_strip> power_strip_factory::create(
     }
     }
 }
+
+auto power_strip_factory::create(std::shared_ptr<io_trace_replay> replay,
+    const io_trace_record &device) -> std::shared_ptr<sokketter::power_strip>
+{
+    auto ptr = create(sokketter::power_strip_type(device.value));
+
+    auto *base_ptr = dynamic_cast<power_strip_base *>(ptr.get());
+    if (base_ptr == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: recorded power strip cannot be replayed!",
+            device.device_id);
+        return nullptr;
+    }
+
+    sokketter::power_strip_configuration configuration;
+    configuration.id = device.device_id;
+    configuration.address = device.request_data;
+    configuration.name = device.response_data;
+
+    return base_ptr->initialize(replay, configuration) ? ptr : nullptr;
+}
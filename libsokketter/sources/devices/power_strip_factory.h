@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <io_trace.h>
 #include <libsokketter.h>
 #include <third-party/kommpot/libkommpot/include/libkommpot.h>
 
@@ -13,6 +14,8 @@ namespace power_strip_factory {
     auto create(std::shared_ptr<kommpot::device_communication> communication)
         -> std::shared_ptr<sokketter::power_strip>;
     auto create(const sokketter::power_strip_type &type) -> std::shared_ptr<sokketter::power_strip>;
+    auto create(std::shared_ptr<io_trace_replay> replay, const io_trace_record &device)
+        -> std::shared_ptr<sokketter::power_strip>;
 }; // namespace power_strip_factory
 
 #endif // POWER_STRIP_FACTORY_H
@@ -1,12 +1,21 @@
 #include "test_device.h"
 
 #include <map>
+#include <mutex>
 #include <sokketter_core.h>
 #include <spdlog/spdlog.h>
 
-static std::map<std::string, std::vector<sokketter::socket>> gs_sockets;
+/**
+ * @brief socket states shared by all test devices with the same serial number, so they survive
+ * listing the devices again.
+ */
 static std::map<std::string, std::vector<bool>> gs_socket_states;
 
+/**
+ * @brief guards the shared socket states, test devices are also driven from the I/O pool threads.
+ */
+static std::mutex gs_socket_states_mutex;
+
 test_device::test_device(const size_t &index)
     : m_index(index)
 {
@@ -21,20 +30,26 @@ test_device::test_device(const size_t &index)
 
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: construction.", this->to_string());
 
-    if (gs_socket_states[m_serial_number].size() != m_socket_number)
     {
-        gs_socket_states[m_serial_number].resize(m_socket_number, false);
-    }
+        const std::lock_guard<std::mutex> lock(gs_socket_states_mutex);
 
-    gs_sockets[m_serial_number].clear();
+        if (gs_socket_states[m_serial_number].size() != m_socket_number)
+        {
+            gs_socket_states[m_serial_number].resize(m_socket_number, false);
+        }
+    }
 
+    /**
+     * @attention every device owns its sockets, so listing the devices again never changes the
+     * sockets another thread is using.
+     */
     for (size_t socket_index = 1; socket_index < m_socket_number + 1; socket_index++)
     {
         sokketter::socket socket(socket_index,
             std::bind(
                 &test_device::power_socket, this, std::placeholders::_1, std::placeholders::_2),
             std::bind(&test_device::socket_status, this, std::placeholders::_1));
-        gs_sockets[m_serial_number].push_back(socket);
+        m_sockets.push_back(socket);
     }
 }
 
@@ -53,28 +68,25 @@ auto test_device::is_connected() const -> bool
     return true;
 }
 
-auto test_device::sockets() const -> const std::vector<sokketter::socket> &
-{
-    return gs_sockets[m_serial_number];
-}
-
 auto test_device::socket(const size_t &index)
     -> const std::optional<std::reference_wrapper<sokketter::socket>>
 {
-    if (index >= gs_sockets[m_serial_number].size())
+    if (index >= m_sockets.size())
     {
         SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: index {} is out of range 0-{}!",
-            this->to_string(), index, gs_sockets[m_serial_number].size());
+            this->to_string(), index, m_sockets.size());
         return std::nullopt;
     }
 
-    return gs_sockets[m_serial_number][index];
+    return m_sockets[index];
 }
 
 auto test_device::power_socket(size_t index, bool is_toggled) -> bool
 {
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: powering socket {} {}.", this->to_string(), index,
         is_toggled ? "on" : "off");
+
+    const std::lock_guard<std::mutex> lock(gs_socket_states_mutex);
     gs_socket_states[m_serial_number][index - 1] = is_toggled;
     return true;
 }
@@ -83,5 +95,7 @@ auto test_device::socket_status(size_t index) -> bool
 {
     SPDLOG_LOGGER_DEBUG(
         SOKKETTER_LOGGER, "{}: checking socket {} status.", this->to_string(), index);
+
+    const std::lock_guard<std::mutex> lock(gs_socket_states_mutex);
     return gs_socket_states[m_serial_number][index - 1];
 }
@@ -0,0 +1,35 @@
+#include "ethernet_communication.h"
+
+ethernet_communication::ethernet_communication(
+    const std::string &ip, const uint16_t &port, const std::string &mac)
+{
+    m_identification.name = "Ethernet device at " + ip;
+    m_identification.ip = ip;
+    m_identification.port = port;
+    m_identification.mac = mac;
+    m_identification.protocol = kommpot::ethernet_protocol_type::TCP;
+}
+
+auto ethernet_communication::identification() -> kommpot::device_identification
+{
+    return m_identification;
+}
+
+auto ethernet_communication::open() -> bool
+{
+    return true;
+}
+
+auto ethernet_communication::close() -> void {}
+
+auto ethernet_communication::read(
+    const kommpot::control_transfer_configuration &configuration, void *data, size_t size) -> bool
+{
+    return false;
+}
+
+auto ethernet_communication::write(
+    const kommpot::control_transfer_configuration &configuration, void *data, size_t size) -> bool
+{
+    return false;
+}
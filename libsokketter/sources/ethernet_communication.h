@@ -0,0 +1,37 @@
+#ifndef ETHERNET_COMMUNICATION_H
+#define ETHERNET_COMMUNICATION_H
+
+#pragma once
+
+#include <third-party/kommpot/libkommpot/include/libkommpot.h>
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief communication of an Ethernet power strip found by the library itself instead of kommpot.
+ *
+ * Ethernet power strips are driven over HTTP by their drivers, so the communication only carries
+ * the identification of the strip and has no transfers of its own.
+ */
+class ethernet_communication final : public kommpot::device_communication
+{
+public:
+    ethernet_communication(const std::string &ip, const uint16_t &port, const std::string &mac);
+    ~ethernet_communication() override = default;
+
+    auto identification() -> kommpot::device_identification override;
+
+    auto open() -> bool override;
+    auto close() -> void override;
+
+    auto read(const kommpot::control_transfer_configuration &configuration, void *data,
+        size_t size) -> bool override;
+    auto write(const kommpot::control_transfer_configuration &configuration, void *data,
+        size_t size) -> bool override;
+
+private:
+    kommpot::ethernet_device_identification m_identification;
+};
+
+#endif // ETHERNET_COMMUNICATION_H
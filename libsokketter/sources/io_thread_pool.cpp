@@ -0,0 +1,110 @@
+#include "io_thread_pool.h"
+
+#include <sokketter_core.h>
+#include <spdlog/spdlog.h>
+
+#include <exception>
+
+io_thread_pool::io_thread_pool(const size_t &thread_count)
+    : m_thread_count(thread_count > 0 ? thread_count : 1)
+{}
+
+io_thread_pool::~io_thread_pool()
+{
+    stop();
+}
+
+auto io_thread_pool::submit(std::function<void()> task) -> void
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_tasks.push_back(std::move(task));
+
+        /**
+         * @attention tasks submitted by a draining worker are run by the workers being stopped,
+         * starting new ones would leave them unjoined.
+         */
+        if (m_workers.empty() && !m_is_stopping)
+        {
+            start_workers();
+        }
+    }
+
+    m_condition.notify_one();
+}
+
+auto io_thread_pool::start_workers() -> void
+{
+    for (size_t index = 0; index < m_thread_count; ++index)
+    {
+        m_workers.emplace_back(&io_thread_pool::worker_loop, this);
+    }
+}
+
+auto io_thread_pool::stop() -> void
+{
+    std::vector<std::thread> workers;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_is_stopping = true;
+        workers.swap(m_workers);
+    }
+
+    m_condition.notify_all();
+
+    for (auto &worker : workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_is_stopping = false;
+
+    /**
+     * @attention a task submitted after the last worker exited is not dropped either.
+     */
+    if (!m_tasks.empty())
+    {
+        start_workers();
+    }
+}
+
+auto io_thread_pool::worker_loop() -> void
+{
+    while (true)
+    {
+        std::function<void()> task = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_is_stopping || !m_tasks.empty(); });
+
+            /**
+             * @attention queued tasks are drained before stopping, so no submitted completion is
+             * silently dropped.
+             */
+            if (m_tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception &exception)
+        {
+            SPDLOG_LOGGER_ERROR(
+                SOKKETTER_LOGGER, "Asynchronous device task failed: {}.", exception.what());
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef IO_THREAD_POOL_H
+#define IO_THREAD_POOL_H
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief fixed-size pool of worker threads running blocking device I/O tasks.
+ *
+ * Workers are started on the first submitted task, so hosts that never use the asynchronous API
+ * do not pay for idle threads.
+ */
+class io_thread_pool
+{
+public:
+    explicit io_thread_pool(const size_t &thread_count);
+    ~io_thread_pool();
+
+    io_thread_pool(const io_thread_pool &) = delete;
+    auto operator=(const io_thread_pool &) -> io_thread_pool & = delete;
+
+    /**
+     * @brief queues the task to be run on one of the workers.
+     */
+    auto submit(std::function<void()> task) -> void;
+
+    /**
+     * @brief runs all queued tasks to completion and joins the workers.
+     * @attention the pool can be used again afterwards, workers are restarted on demand.
+     */
+    auto stop() -> void;
+
+private:
+    size_t m_thread_count = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_workers;
+    bool m_is_stopping = false;
+
+    /**
+     * @attention called with the mutex held.
+     */
+    auto start_workers() -> void;
+    auto worker_loop() -> void;
+};
+
+#endif // IO_THREAD_POOL_H
@@ -0,0 +1,283 @@
+#include "io_trace.h"
+
+#include <sokketter_core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+template <typename value_type>
+auto write_integer(std::ostream &stream, const value_type value) -> void
+{
+    std::array<char, sizeof(value_type)> bytes = {};
+    for (size_t index = 0; index < bytes.size(); ++index)
+    {
+        bytes[index] = static_cast<char>((static_cast<uint64_t>(value) >> (8 * index)) & 0xff);
+    }
+
+    stream.write(bytes.data(), bytes.size());
+}
+
+template <typename value_type>
+auto read_integer(std::istream &stream, value_type &value) -> bool
+{
+    std::array<unsigned char, sizeof(value_type)> bytes = {};
+    if (!stream.read(reinterpret_cast<char *>(bytes.data()), bytes.size()))
+    {
+        return false;
+    }
+
+    uint64_t result = 0;
+    for (size_t index = 0; index < bytes.size(); ++index)
+    {
+        result |= static_cast<uint64_t>(bytes[index]) << (8 * index);
+    }
+
+    value = static_cast<value_type>(result);
+
+    return true;
+}
+
+auto write_blob(std::ostream &stream, const std::string &blob) -> void
+{
+    write_integer(stream, static_cast<uint32_t>(blob.size()));
+    stream.write(blob.data(), blob.size());
+}
+
+auto read_blob(std::istream &stream, std::string &blob) -> bool
+{
+    uint32_t length = 0;
+    if (!read_integer(stream, length))
+    {
+        return false;
+    }
+
+    blob.resize(length);
+
+    return length == 0 || static_cast<bool>(stream.read(blob.data(), length));
+}
+
+auto io_trace_format::write_header(std::ostream &stream) -> void
+{
+    stream.write(MAGIC, sizeof(MAGIC));
+    write_integer(stream, VERSION);
+}
+
+auto io_trace_format::read_header(std::istream &stream) -> bool
+{
+    std::array<char, sizeof(MAGIC)> magic = {};
+    if (!stream.read(magic.data(), magic.size()) ||
+        !std::equal(magic.begin(), magic.end(), std::begin(MAGIC)))
+    {
+        return false;
+    }
+
+    uint16_t version = 0;
+    return read_integer(stream, version) && version == VERSION;
+}
+
+auto io_trace_format::write_record(std::ostream &stream, const io_trace_record &record) -> void
+{
+    write_integer(stream, static_cast<uint8_t>(record.type));
+    write_integer(stream, static_cast<uint8_t>(record.is_successful ? 1 : 0));
+    write_integer(stream, record.timestamp_usec);
+    write_integer(stream, record.duration_usec);
+    write_integer(stream, record.request_type);
+    write_integer(stream, record.request);
+    write_integer(stream, record.value);
+    write_integer(stream, record.index);
+    write_blob(stream, record.device_id);
+    write_blob(stream, record.request_data);
+    write_blob(stream, record.response_data);
+}
+
+auto io_trace_format::read_record(std::istream &stream, io_trace_record &record) -> bool
+{
+    uint8_t type = 0;
+    uint8_t flags = 0;
+
+    if (!read_integer(stream, type) || !read_integer(stream, flags) ||
+        !read_integer(stream, record.timestamp_usec) ||
+        !read_integer(stream, record.duration_usec) ||
+        !read_integer(stream, record.request_type) || !read_integer(stream, record.request) ||
+        !read_integer(stream, record.value) || !read_integer(stream, record.index) ||
+        !read_blob(stream, record.device_id) || !read_blob(stream, record.request_data) ||
+        !read_blob(stream, record.response_data))
+    {
+        return false;
+    }
+
+    record.type = io_trace_record_type(type);
+    record.is_successful = (flags & 1) != 0;
+
+    return true;
+}
+
+auto io_trace_recorder::start(const std::filesystem::path &path) -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_file.is_open())
+    {
+        m_is_recording = false;
+        m_file.close();
+    }
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open())
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "Failed opening the I/O trace file '{}'!", path.string());
+        return false;
+    }
+
+    io_trace_format::write_header(m_file);
+
+    m_start_ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+    m_is_recording = true;
+
+    SPDLOG_LOGGER_INFO(SOKKETTER_LOGGER, "Recording I/O trace to '{}'.", path.string());
+
+    return true;
+}
+
+auto io_trace_recorder::stop() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    m_is_recording = false;
+    m_file.close();
+
+    SPDLOG_LOGGER_INFO(SOKKETTER_LOGGER, "I/O trace recording is stopped.");
+}
+
+auto io_trace_recorder::elapsed_usec() const -> uint64_t
+{
+    const std::chrono::steady_clock::time_point start_time(
+        std::chrono::steady_clock::duration(m_start_ticks.load()));
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time)
+        .count();
+}
+
+auto io_trace_recorder::record(const io_trace_record &record) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_is_recording || !m_file.is_open())
+    {
+        return;
+    }
+
+    io_trace_format::write_record(m_file, record);
+}
+
+auto io_trace_recorder::record_device(const sokketter::power_strip &device) -> void
+{
+    if (!is_recording() || !device.is_connected())
+    {
+        return;
+    }
+
+    io_trace_record record;
+    record.type = io_trace_record_type::DEVICE;
+    record.is_successful = true;
+    record.timestamp_usec = elapsed_usec();
+    record.value = static_cast<uint16_t>(device.configuration().type);
+    record.device_id = device.configuration().id;
+    record.request_data = device.configuration().address;
+    record.response_data = device.configuration().name;
+
+    this->record(record);
+}
+
+io_trace_replay::io_trace_replay(const std::filesystem::path &path, const double &speed)
+    : m_speed(speed)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "Failed opening the I/O trace file '{}'!", path.string());
+        return;
+    }
+
+    if (!io_trace_format::read_header(file))
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "File '{}' is not a supported I/O trace!",
+            path.string());
+        return;
+    }
+
+    io_trace_record record;
+    while (io_trace_format::read_record(file, record))
+    {
+        if (record.type == io_trace_record_type::DEVICE)
+        {
+            m_devices.push_back(record);
+        }
+        else
+        {
+            m_exchanges[record.device_id].push_back(record);
+        }
+    }
+
+    m_is_valid = true;
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Loaded I/O trace '{}' with {} devices.", path.string(),
+        m_devices.size());
+}
+
+auto io_trace_replay::is_valid() const noexcept -> bool
+{
+    return m_is_valid;
+}
+
+auto io_trace_replay::devices() const -> const std::vector<io_trace_record> &
+{
+    return m_devices;
+}
+
+auto io_trace_replay::next(const std::string &device_id, const io_trace_record_type &type)
+    -> std::optional<io_trace_record>
+{
+    std::optional<io_trace_record> record = std::nullopt;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto &exchanges = m_exchanges[device_id];
+        if (exchanges.empty())
+        {
+            SPDLOG_LOGGER_ERROR(
+                SOKKETTER_LOGGER, "{}: I/O trace has no exchanges left to replay!", device_id);
+            return std::nullopt;
+        }
+
+        if (exchanges.front().type != type)
+        {
+            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
+                "{}: I/O trace diverged, recorded exchange type {} does not match requested {}!",
+                device_id, static_cast<int>(exchanges.front().type), static_cast<int>(type));
+            return std::nullopt;
+        }
+
+        record = exchanges.front();
+        exchanges.pop_front();
+    }
+
+    if (m_speed > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(
+            static_cast<double>(record->duration_usec) / m_speed));
+    }
+
+    return record;
+}
@@ -0,0 +1,171 @@
+#ifndef IO_TRACE_H
+#define IO_TRACE_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief the enum specifying kinds of records stored in an I/O trace.
+ */
+enum class io_trace_record_type : uint8_t
+{
+    UNKNOWN = 0,
+
+    /**
+     * @brief power strip present when the trace was taken, value holds its power_strip_type,
+     * request its address and response its name.
+     */
+    DEVICE = 1,
+
+    USB_CONTROL_READ = 2,
+    USB_CONTROL_WRITE = 3,
+    HTTP_GET = 4,
+    HTTP_POST = 5
+};
+
+/**
+ * @brief single device exchange stored in an I/O trace.
+ */
+struct io_trace_record
+{
+    io_trace_record_type type = io_trace_record_type::UNKNOWN;
+    bool is_successful = false;
+
+    /**
+     * @brief microseconds since the trace was started.
+     */
+    uint64_t timestamp_usec = 0;
+    uint64_t duration_usec = 0;
+
+    /**
+     * @brief USB control transfer setup, zero for other records.
+     */
+    uint8_t request_type = 0;
+    uint8_t request = 0;
+    uint16_t value = 0;
+    uint16_t index = 0;
+
+    /**
+     * @brief identifier of the power strip, empty while it is not known yet.
+     */
+    std::string device_id = "";
+
+    /**
+     * @brief written payload for USB, URL and form fields for HTTP.
+     */
+    std::string request_data = "";
+
+    /**
+     * @brief read payload for USB, response body for HTTP.
+     */
+    std::string response_data = "";
+};
+
+/**
+ * @brief binary trace file layout.
+ *
+ * The file starts with the 8-byte magic "SOKTRACE" and a little-endian uint16 version. Each record
+ * follows as: uint8 type, uint8 flags (bit 0 set on success), uint64 timestamp, uint64 duration,
+ * uint8 request type, uint8 request, uint16 value, uint16 index, and three length-prefixed blobs
+ * (uint32 length followed by bytes): device id, request data and response data.
+ */
+namespace io_trace_format {
+    inline constexpr char MAGIC[] = {'S', 'O', 'K', 'T', 'R', 'A', 'C', 'E'};
+    inline constexpr uint16_t VERSION = 1;
+
+    auto write_header(std::ostream &stream) -> void;
+    auto read_header(std::istream &stream) -> bool;
+
+    auto write_record(std::ostream &stream, const io_trace_record &record) -> void;
+    auto read_record(std::istream &stream, io_trace_record &record) -> bool;
+} // namespace io_trace_format
+
+/**
+ * @brief writes device exchanges to a binary trace file while a capture is running.
+ */
+class io_trace_recorder
+{
+public:
+    io_trace_recorder() = default;
+    ~io_trace_recorder() = default;
+
+    auto start(const std::filesystem::path &path) -> bool;
+    auto stop() -> void;
+
+    [[nodiscard]] auto is_recording() const noexcept -> bool
+    {
+        return m_is_recording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief gets microseconds elapsed since the capture was started.
+     */
+    [[nodiscard]] auto elapsed_usec() const -> uint64_t;
+
+    auto record(const io_trace_record &record) -> void;
+
+    auto record_device(const sokketter::power_strip &device) -> void;
+
+private:
+    std::atomic_bool m_is_recording = false;
+
+    std::mutex m_mutex;
+    std::ofstream m_file;
+
+    /**
+     * @brief steady clock ticks at the start of the capture, read by the drivers without m_mutex.
+     */
+    std::atomic<std::chrono::steady_clock::rep> m_start_ticks = 0;
+};
+
+/**
+ * @brief serves recorded exchanges back to the drivers instead of talking to real devices.
+ */
+class io_trace_replay
+{
+public:
+    /**
+     * @brief loads the trace file.
+     * @param path of the trace file.
+     * @param speed replay speed factor, 1.0 reproduces recorded timings, 0 disables waiting.
+     */
+    io_trace_replay(const std::filesystem::path &path, const double &speed);
+
+    [[nodiscard]] auto is_valid() const noexcept -> bool;
+
+    /**
+     * @brief gets the power strips present in the trace.
+     */
+    [[nodiscard]] auto devices() const -> const std::vector<io_trace_record> &;
+
+    /**
+     * @brief takes the next recorded exchange of the device, waiting for its recorded duration.
+     * @return record or std::nullopt when the trace has no matching exchange left.
+     */
+    auto next(const std::string &device_id, const io_trace_record_type &type)
+        -> std::optional<io_trace_record>;
+
+private:
+    bool m_is_valid = false;
+    double m_speed = 1.0;
+
+    std::vector<io_trace_record> m_devices;
+
+    std::mutex m_mutex;
+    std::map<std::string, std::deque<io_trace_record>> m_exchanges;
+};
+
+#endif // IO_TRACE_H
@@ -0,0 +1,433 @@
+#include "lan_discovery.h"
+
+#include <sokketter_core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <curl/curl.h>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string_view>
+
+/**
+ * @brief state of a single in-flight probe.
+ */
+struct lan_probe
+{
+    lan_candidate candidate;
+    std::string response = "";
+};
+
+/**
+ * @brief the login form is the only page an unauthenticated client gets from the power strip.
+ */
+constexpr auto LOGIN_PAGE_MARKER = "login.html";
+
+/**
+ * @brief the login form of the power strip posts to this action, see energenie_eg_pmxx_lan.
+ */
+constexpr std::string_view LOGIN_FORM_ACTION = "action=\"/login.html\"";
+
+/**
+ * @brief brand shown by the web interface of the power strip, compared case-insensitively.
+ */
+constexpr std::string_view BRAND_MARKER = "energenie";
+
+/**
+ * @brief response bytes read from each host, enough to cover the login page.
+ */
+constexpr size_t PROBE_RESPONSE_LIMIT = 4096;
+
+auto parse_ipv4(const std::string &text, uint32_t &address) -> bool
+{
+    std::array<uint32_t, 4> octets = {};
+    char dot = '\0';
+
+    std::istringstream stream(text);
+    for (size_t index = 0; index < octets.size(); ++index)
+    {
+        if (index > 0 && (!(stream >> dot) || dot != '.'))
+        {
+            return false;
+        }
+
+        if (!(stream >> octets[index]) || octets[index] > 255)
+        {
+            return false;
+        }
+    }
+
+    if (stream.peek() != std::char_traits<char>::eof())
+    {
+        return false;
+    }
+
+    address = (octets[0] << 24) | (octets[1] << 16) | (octets[2] << 8) | octets[3];
+
+    return true;
+}
+
+auto format_ipv4(const uint32_t &address) -> std::string
+{
+    return std::to_string((address >> 24) & 0xff) + "." + std::to_string((address >> 16) & 0xff) +
+           "." + std::to_string((address >> 8) & 0xff) + "." + std::to_string(address & 0xff);
+}
+
+auto probe_write_callback(char *data, size_t size, size_t count, void *user_data) -> size_t
+{
+    const size_t length = size * count;
+    auto *probe = static_cast<lan_probe *>(user_data);
+
+    probe->response.append(data, std::min(length, PROBE_RESPONSE_LIMIT - probe->response.size()));
+
+    /**
+     * @attention returning less than received ends the transfer, the rest of the page is not
+     * needed to recognize the power strip.
+     */
+    return probe->response.size() < PROBE_RESPONSE_LIMIT ? length : 0;
+}
+
+auto lan_discovery::subnet_hosts(const std::string &subnet, std::vector<std::string> &hosts)
+    -> bool
+{
+    const auto separator = subnet.find('/');
+    const std::string address_text = subnet.substr(0, separator);
+
+    uint32_t address = 0;
+    if (!parse_ipv4(address_text, address))
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "Discovery subnet '{}' has no valid address!", subnet);
+        return false;
+    }
+
+    uint32_t prefix_length = 32;
+    if (separator != std::string::npos)
+    {
+        const std::string prefix_text = subnet.substr(separator + 1);
+        if (prefix_text.empty() ||
+            !std::all_of(prefix_text.begin(), prefix_text.end(),
+                [](const char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; }) ||
+            prefix_text.size() > 2 || std::stoul(prefix_text) > 32)
+        {
+            SPDLOG_LOGGER_ERROR(
+                SOKKETTER_LOGGER, "Discovery subnet '{}' has no valid prefix length!", subnet);
+            return false;
+        }
+
+        prefix_length = static_cast<uint32_t>(std::stoul(prefix_text));
+    }
+
+    if (prefix_length < MINIMUM_PREFIX_LENGTH)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
+            "Discovery subnet '{}' is wider than /{}, refusing to sweep it!", subnet,
+            MINIMUM_PREFIX_LENGTH);
+        return false;
+    }
+
+    if (prefix_length >= 31)
+    {
+        const uint32_t host_count = prefix_length == 32 ? 1 : 2;
+        const uint32_t first = prefix_length == 32 ? address : address & ~uint32_t(1);
+        for (uint32_t offset = 0; offset < host_count; ++offset)
+        {
+            hosts.push_back(format_ipv4(first + offset));
+        }
+        return true;
+    }
+
+    /**
+     * @attention network and broadcast addresses never belong to a host.
+     */
+    const uint32_t mask = ~uint32_t(0) << (32 - prefix_length);
+    const uint32_t network = address & mask;
+    const uint32_t broadcast = network | ~mask;
+
+    for (uint32_t host = network + 1; host < broadcast; ++host)
+    {
+        hosts.push_back(format_ipv4(host));
+    }
+
+    return true;
+}
+
+auto lan_discovery::neighbour_table() -> std::map<std::string, std::string>
+{
+    std::map<std::string, std::string> table;
+
+#ifdef __linux__
+    std::ifstream file("/proc/net/arp");
+    if (!file.is_open())
+    {
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Neighbour table is not readable.");
+        return table;
+    }
+
+    /**
+     * @brief skip the header line.
+     */
+    std::string line;
+    std::getline(file, line);
+
+    while (std::getline(file, line))
+    {
+        std::istringstream stream(line);
+
+        std::string ip;
+        std::string hardware_type;
+        std::string flags;
+        std::string mac;
+        if (!(stream >> ip >> hardware_type >> flags >> mac))
+        {
+            continue;
+        }
+
+        /**
+         * @attention incomplete entries carry no hardware address.
+         */
+        if (flags == "0x0" || mac == "00:00:00:00:00:00")
+        {
+            continue;
+        }
+
+        std::transform(mac.begin(), mac.end(), mac.begin(), [](const char c) {
+            return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        });
+
+        table[ip] = mac;
+    }
+#endif
+
+    return table;
+}
+
+auto lan_discovery::is_neighbour_table_available() -> bool
+{
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto lan_discovery::is_ipv4_address(const std::string &text) -> bool
+{
+    uint32_t address = 0;
+    return parse_ipv4(text, address);
+}
+
+auto lan_discovery::normalize_mac(const std::string &text, std::string &mac) -> bool
+{
+    constexpr size_t MAC_LENGTH = 17;
+
+    if (text.size() != MAC_LENGTH)
+    {
+        return false;
+    }
+
+    std::string normalized = text;
+    for (size_t index = 0; index < normalized.size(); ++index)
+    {
+        const auto character = static_cast<unsigned char>(normalized[index]);
+
+        if (index % 3 == 2)
+        {
+            if (character != ':' && character != '-')
+            {
+                return false;
+            }
+
+            normalized[index] = ':';
+            continue;
+        }
+
+        if (std::isxdigit(character) == 0)
+        {
+            return false;
+        }
+
+        normalized[index] = static_cast<char>(std::toupper(character));
+    }
+
+    mac = normalized;
+
+    return true;
+}
+
+auto lan_discovery::is_energenie_mac(const std::string &mac) -> bool
+{
+    return mac.rfind(ENERGENIE_MAC_PREFIX, 0) == 0;
+}
+
+auto lan_discovery::is_power_strip_page(const std::string &page) -> bool
+{
+    if (page.find(LOGIN_FORM_ACTION) == std::string::npos)
+    {
+        return false;
+    }
+
+    const auto brand = std::search(page.begin(), page.end(), BRAND_MARKER.begin(),
+        BRAND_MARKER.end(), [](const char a, const char b) {
+            return std::tolower(static_cast<unsigned char>(a)) == b;
+        });
+
+    return brand != page.end();
+}
+
+auto lan_discovery::find_energenie_mac(const std::string &page, std::string &mac) -> bool
+{
+    constexpr size_t MAC_LENGTH = 17;
+
+    for (size_t position = 0; position + MAC_LENGTH <= page.size(); ++position)
+    {
+        std::string normalized = "";
+        if (normalize_mac(page.substr(position, MAC_LENGTH), normalized) &&
+            is_energenie_mac(normalized))
+        {
+            mac = normalized;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+auto lan_discovery::probe(const std::vector<lan_candidate> &candidates, const uint16_t &port,
+    const size_t &concurrency, const uint32_t &timeout_msec, const std::atomic_bool &abort,
+    const std::function<void(const lan_candidate &)> &found_cb) -> void
+{
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    CURLM *multi = curl_multi_init();
+    if (multi == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "Failed to initialize curl for Ethernet discovery.");
+        return;
+    }
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Probing {} Ethernet hosts, {} at a time.",
+        candidates.size(), concurrency);
+
+    const size_t window = std::max<size_t>(concurrency, 1);
+
+    std::map<CURL *, std::unique_ptr<lan_probe>> active;
+    size_t next = 0;
+
+    const auto complete = [&](CURL *curl) {
+        auto probe = std::move(active[curl]);
+        active.erase(curl);
+
+        curl_multi_remove_handle(multi, curl);
+        curl_easy_cleanup(curl);
+
+        if (probe->response.find(LOGIN_PAGE_MARKER) == std::string::npos)
+        {
+            return;
+        }
+
+        /**
+         * @attention the host was just contacted, so the kernel knows its current MAC address even
+         * when the address was handed to another device since the last run.
+         */
+        const auto table = neighbour_table();
+        const auto entry = table.find(probe->candidate.ip);
+        if (entry != table.end())
+        {
+            probe->candidate.mac = entry->second;
+        }
+        else
+        {
+            /**
+             * @attention hosts behind a router have no neighbour entry, so they are recognized by
+             * their page and identified by the MAC address it shows or the stored one.
+             */
+            if (!is_power_strip_page(probe->response))
+            {
+                SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+                    "Host {} answered, but neither its MAC address nor its page is one of a power "
+                    "strip.",
+                    probe->candidate.ip);
+                return;
+            }
+
+            std::string page_mac = "";
+            if (find_energenie_mac(probe->response, page_mac))
+            {
+                probe->candidate.mac = page_mac;
+            }
+        }
+
+        if (!is_energenie_mac(probe->candidate.mac))
+        {
+            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+                "Host {} answered, but its MAC address '{}' is not one of a power strip.",
+                probe->candidate.ip, probe->candidate.mac);
+            return;
+        }
+
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Found Ethernet power strip {} at {}.",
+            probe->candidate.mac, probe->candidate.ip);
+
+        found_cb(probe->candidate);
+    };
+
+    while ((next < candidates.size() || !active.empty()) && !abort.load())
+    {
+        while (active.size() < window && next < candidates.size())
+        {
+            auto probe = std::make_unique<lan_probe>();
+            probe->candidate = candidates[next++];
+
+            const std::string url =
+                "http://" + probe->candidate.ip + ":" + std::to_string(port) + "/";
+
+            CURL *curl = curl_easy_init();
+            if (curl == nullptr)
+            {
+                continue;
+            }
+
+            curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+            curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+            curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(timeout_msec));
+            curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(timeout_msec) * 2);
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, probe_write_callback);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, probe.get());
+
+            curl_multi_add_handle(multi, curl);
+            active[curl] = std::move(probe);
+        }
+
+        int running = 0;
+        curl_multi_perform(multi, &running);
+
+        int queued = 0;
+        while (CURLMsg *message = curl_multi_info_read(multi, &queued))
+        {
+            if (message->msg == CURLMSG_DONE)
+            {
+                complete(message->easy_handle);
+            }
+        }
+
+        if (!active.empty())
+        {
+            curl_multi_wait(multi, nullptr, 0, 50, nullptr);
+        }
+    }
+
+    for (auto &[curl, probe] : active)
+    {
+        curl_multi_remove_handle(multi, curl);
+        curl_easy_cleanup(curl);
+    }
+
+    curl_multi_cleanup(multi);
+}
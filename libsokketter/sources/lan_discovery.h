@@ -0,0 +1,99 @@
+#ifndef LAN_DISCOVERY_H
+#define LAN_DISCOVERY_H
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief host probed during Ethernet discovery.
+ */
+struct lan_candidate
+{
+    std::string ip = "";
+
+    /**
+     * @brief MAC address stored for the host, empty when it has to be taken from the neighbour
+     * table or the page of the host.
+     */
+    std::string mac = "";
+};
+
+/**
+ * @brief discovery of Ethernet power strips over HTTP, run by the library when the neighbour table
+ * can be read or discovery subnets are configured. It replaces the Ethernet scan of kommpot only
+ * when subnets are configured.
+ */
+namespace lan_discovery {
+    /**
+     * @brief MAC address prefix of Energenie Ethernet power strips.
+     */
+    inline constexpr auto ENERGENIE_MAC_PREFIX = "88:B6:27";
+
+    /**
+     * @brief narrowest accepted subnet prefix, wider subnets are rejected instead of swept.
+     */
+    inline constexpr uint32_t MINIMUM_PREFIX_LENGTH = 16;
+
+    /**
+     * @brief appends host addresses of the IPv4 subnet to the list.
+     * @param subnet in CIDR notation, e.g. "192.168.0.0/24", a plain address is a single host.
+     * @return true if the subnet was valid, false otherwise.
+     */
+    auto subnet_hosts(const std::string &subnet, std::vector<std::string> &hosts) -> bool;
+
+    /**
+     * @brief reads IPv4 addresses and upper-case MAC addresses from the kernel neighbour table.
+     * @attention only Linux exposes it without extra dependencies, other systems get an empty map.
+     */
+    auto neighbour_table() -> std::map<std::string, std::string>;
+
+    /**
+     * @brief checks that neighbour_table() is supported on this system.
+     */
+    auto is_neighbour_table_available() -> bool;
+
+    /**
+     * @brief checks that the text is a dotted IPv4 address without prefix length.
+     */
+    auto is_ipv4_address(const std::string &text) -> bool;
+
+    /**
+     * @brief converts the MAC address to the upper-case, colon-separated form used as identifier.
+     * @param text MAC address separated with colons or dashes.
+     * @return true if the address was valid, false otherwise.
+     */
+    auto normalize_mac(const std::string &text, std::string &mac) -> bool;
+
+    auto is_energenie_mac(const std::string &mac) -> bool;
+
+    /**
+     * @brief recognizes the login page of a power strip by its login form and brand, used for
+     * hosts without a neighbour table entry, e.g. on routed subnets.
+     */
+    auto is_power_strip_page(const std::string &page) -> bool;
+
+    /**
+     * @brief finds the first MAC address with the Energenie prefix shown on the page.
+     * @return true if one was found, false otherwise.
+     */
+    auto find_energenie_mac(const std::string &page, std::string &mac) -> bool;
+
+    /**
+     * @brief probes the candidates in order over HTTP, keeping at most the given number of
+     * requests in flight.
+     * @param found_cb called on the probing thread for each host answering like a power strip, with
+     * the MAC address resolved from the neighbour table, the page or the candidate.
+     * @param abort stops probing as soon as it is set.
+     */
+    auto probe(const std::vector<lan_candidate> &candidates, const uint16_t &port,
+        const size_t &concurrency, const uint32_t &timeout_msec, const std::atomic_bool &abort,
+        const std::function<void(const lan_candidate &)> &found_cb) -> void;
+} // namespace lan_discovery
+
+#endif // LAN_DISCOVERY_H
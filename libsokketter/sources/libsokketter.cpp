@@ -1,13 +1,20 @@
 #include "libsokketter.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <exception>
+#include <future>
+#include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include <call_context.h>
 #include <database_storage.h>
 #include <devices/power_strip_base.h>
 #include <devices/power_strip_factory.h>
 #include <devices/test_device.h>
+#include <io_trace.h>
 #include <sokketter_core.h>
 #include <spdlog/spdlog.h>
 #include <third-party/kommpot/libkommpot/include/libkommpot.h>
@@ -145,12 +152,38 @@ sokketter::socket::socket(const socket_configuration &configuration)
 }
 
 sokketter::socket::socket(const size_t index, std::function<bool(size_t, bool)> power_cb,
-    std::function<bool(size_t)> status_cb)
+    std::function<bool(size_t)> status_cb, std::function<socket_state(size_t)> state_cb)
     : m_index(index)
     , m_power_cb(power_cb)
     , m_status_cb(status_cb)
+    , m_state_cb(state_cb)
 {}
 
+sokketter::cancellation_token::cancellation_token()
+    : m_is_cancelled(std::make_shared<std::atomic_bool>(false))
+{
+}
+
+auto sokketter::cancellation_token::cancel() const noexcept -> void
+{
+    m_is_cancelled->store(true);
+}
+
+auto sokketter::cancellation_token::is_cancelled() const noexcept -> bool
+{
+    return m_is_cancelled->load();
+}
+
+sokketter::call_scope::call_scope(const call_options &options)
+{
+    call_context::enter(options);
+}
+
+sokketter::call_scope::~call_scope()
+{
+    call_context::leave();
+}
+
 auto sokketter::socket::configuration() const noexcept -> const socket_configuration &
 {
     return m_configuration;
@@ -202,6 +235,45 @@ auto sokketter::socket::is_powered_on() const noexcept -> bool
     return m_status_cb(m_index);
 }
 
+auto sokketter::socket::state() const noexcept -> socket_state
+{
+    if (m_state_cb != nullptr)
+    {
+        return m_state_cb(m_index);
+    }
+
+    socket_state state;
+    if (m_status_cb == nullptr)
+    {
+        SPDLOG_LOGGER_WARN(SOKKETTER_LOGGER,
+            "Trying to check state of socket {} without set callback!", this->configuration().name);
+        return state;
+    }
+
+    state.is_powered_on = m_status_cb(m_index);
+    state.is_valid = true;
+
+    return state;
+}
+
+auto sokketter::socket::power(const bool &on, const call_options &options) const noexcept -> bool
+{
+    const call_scope scope(options);
+    return power(on);
+}
+
+auto sokketter::socket::toggle(const call_options &options) const noexcept -> bool
+{
+    const call_scope scope(options);
+    return toggle();
+}
+
+auto sokketter::socket::state(const call_options &options) const noexcept -> socket_state
+{
+    const call_scope scope(options);
+    return state();
+}
+
 auto sokketter::socket::to_string() const noexcept -> std::string
 {
     return this->configuration().name + std::string(", status: ") +
@@ -280,7 +352,10 @@ auto sokketter::power_strip::configuration() const noexcept -> const power_strip
 
 auto sokketter::power_strip::configure(const power_strip_configuration &configuration) -> void
 {
+    const bool is_registered = m_configuration.is_registered;
+
     m_configuration = configuration;
+    m_configuration.is_registered = is_registered;
 }
 
 auto sokketter::power_strip::save() const -> void
@@ -298,6 +373,30 @@ auto sokketter::power_strip::is_connected() const -> bool
     return false;
 }
 
+auto sokketter::power_strip::invalidate_socket_states() -> void {}
+
+auto sokketter::power_strip::power_sockets(const std::map<size_t, bool> &states)
+    -> std::vector<size_t>
+{
+    std::vector<size_t> switched_indices;
+
+    for (const auto &[index, on] : states)
+    {
+        const auto &socket = this->socket(index);
+        if (socket.has_value() && socket->get().power(on))
+        {
+            switched_indices.push_back(index);
+        }
+    }
+
+    return switched_indices;
+}
+
+auto sokketter::power_strip::last_known_socket_states() const -> std::vector<socket_state>
+{
+    return std::vector<socket_state>(m_sockets.size());
+}
+
 auto sokketter::power_strip::sockets() -> std::vector<sokketter::socket> &
 {
     return m_sockets;
@@ -387,6 +486,11 @@ auto sokketter::devices(
     sokketter_core::instance().devices(filter, device_cb, status_cb);
 }
 
+auto sokketter::known_devices() -> std::vector<std::shared_ptr<sokketter::power_strip>>
+{
+    return *sokketter_core::instance().database().get();
+}
+
 auto sokketter::device(const size_t &index) -> std::shared_ptr<sokketter::power_strip>
 {
     if (get_requested_test_device_number() != LIBSOKKETTER_TEST_DEVICE_NUMBER_NOT_SET)
@@ -461,3 +565,446 @@ auto sokketter::forget_device(std::shared_ptr<power_strip> &device) -> void
     sokketter_core::instance().database().remove(device);
     sokketter_core::instance().database().save();
 }
+
+auto sokketter::add_ethernet_device(const std::string &ip, const std::string &mac,
+    const std::string &password) -> std::shared_ptr<power_strip>
+{
+    return sokketter_core::instance().add_ethernet_device(ip, mac, password);
+}
+
+auto sokketter::start_io_trace(const std::filesystem::path &path) -> bool
+{
+    return sokketter_core::instance().start_io_trace(path);
+}
+
+auto sokketter::stop_io_trace() -> void
+{
+    sokketter_core::instance().stop_io_trace();
+}
+
+auto sokketter::replay_io_trace(const std::filesystem::path &path, const double &speed)
+    -> std::vector<std::shared_ptr<sokketter::power_strip>>
+{
+    std::vector<std::shared_ptr<sokketter::power_strip>> devices;
+
+    const auto replay = std::make_shared<io_trace_replay>(path, speed);
+    if (!replay->is_valid())
+    {
+        return devices;
+    }
+
+    for (const auto &recorded_device : replay->devices())
+    {
+        auto device = power_strip_factory::create(replay, recorded_device);
+        if (device == nullptr)
+        {
+            continue;
+        }
+
+        devices.push_back(device);
+    }
+
+    return devices;
+}
+
+auto sokketter::set_executor(executor executor) -> void
+{
+    sokketter_core::instance().set_executor(std::move(executor));
+}
+
+template <typename result_type>
+auto run_device_task(std::shared_ptr<sokketter::power_strip> device,
+    std::function<result_type(sokketter::power_strip &)> task, result_type failure_result,
+    std::function<void(result_type)> completion_cb) -> void
+{
+    if (device == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "Asynchronous operation without a device!");
+
+        sokketter_core::instance().execute([failure_result, completion_cb]() {
+            if (completion_cb != nullptr)
+            {
+                completion_cb(failure_result);
+            }
+        });
+        return;
+    }
+
+    /**
+     * @attention drivers are not safe for concurrent use, so operations on the same power strip
+     * are queued behind each other while different power strips run in parallel.
+     */
+    const auto device_id = device->configuration().id;
+
+    sokketter_core::instance().execute_serialized(
+        device_id, [device, task, failure_result, completion_cb]() {
+            result_type result = failure_result;
+
+            try
+            {
+                result = task(*device);
+            }
+            catch (const std::exception &exception)
+            {
+                SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "{}: asynchronous operation failed: {}.",
+                    device->to_string(), exception.what());
+            }
+
+            if (completion_cb != nullptr)
+            {
+                completion_cb(std::move(result));
+            }
+        });
+}
+
+template <typename result_type>
+auto run_device_task(std::shared_ptr<sokketter::power_strip> device,
+    std::function<result_type(sokketter::power_strip &)> task, result_type failure_result)
+    -> std::future<result_type>
+{
+    auto promise = std::make_shared<std::promise<result_type>>();
+    auto future = promise->get_future();
+
+    run_device_task<result_type>(std::move(device), std::move(task), std::move(failure_result),
+        [promise](result_type result) { promise->set_value(std::move(result)); });
+
+    return future;
+}
+
+auto power_socket_task(const size_t &socket_index, const bool &on)
+    -> std::function<bool(sokketter::power_strip &)>
+{
+    return [socket_index, on](sokketter::power_strip &device) {
+        const auto &socket = device.socket(socket_index);
+        if (!socket.has_value())
+        {
+            return false;
+        }
+
+        return socket->get().power(on);
+    };
+}
+
+auto socket_status_task(const size_t &socket_index)
+    -> std::function<bool(sokketter::power_strip &)>
+{
+    return [socket_index](sokketter::power_strip &device) {
+        const auto &socket = device.socket(socket_index);
+        if (!socket.has_value())
+        {
+            return false;
+        }
+
+        return socket->get().is_powered_on();
+    };
+}
+
+auto authenticate_task() -> std::function<bool(sokketter::power_strip &)>
+{
+    return [](sokketter::power_strip &device) { return device.try_authenticate(); };
+}
+
+auto power_all_task(const bool &on) -> std::function<bool(sokketter::power_strip &)>
+{
+    return [on](sokketter::power_strip &device) {
+        const auto &sockets = device.sockets();
+        if (sockets.empty())
+        {
+            return false;
+        }
+
+        bool is_successful = true;
+        for (const auto &socket : sockets)
+        {
+            is_successful = socket.power(on) && is_successful;
+        }
+
+        return is_successful;
+    };
+}
+
+auto status_all_task() -> std::function<std::vector<bool>(sokketter::power_strip &)>
+{
+    return [](sokketter::power_strip &device) {
+        std::vector<bool> states;
+
+        for (const auto &socket : device.sockets())
+        {
+            states.push_back(socket.is_powered_on());
+        }
+
+        return states;
+    };
+}
+
+auto sokketter::power_async(std::shared_ptr<power_strip> device, const size_t &socket_index,
+    const bool &on) -> std::future<bool>
+{
+    return run_device_task<bool>(std::move(device), power_socket_task(socket_index, on), false);
+}
+
+auto sokketter::power_async(std::shared_ptr<power_strip> device, const size_t &socket_index,
+    const bool &on, completion_callback completion_cb) -> void
+{
+    run_device_task<bool>(
+        std::move(device), power_socket_task(socket_index, on), false, std::move(completion_cb));
+}
+
+auto sokketter::status_async(std::shared_ptr<power_strip> device, const size_t &socket_index)
+    -> std::future<bool>
+{
+    return run_device_task<bool>(std::move(device), socket_status_task(socket_index), false);
+}
+
+auto sokketter::status_async(std::shared_ptr<power_strip> device, const size_t &socket_index,
+    completion_callback completion_cb) -> void
+{
+    run_device_task<bool>(
+        std::move(device), socket_status_task(socket_index), false, std::move(completion_cb));
+}
+
+auto sokketter::authenticate_async(std::shared_ptr<power_strip> device) -> std::future<bool>
+{
+    return run_device_task<bool>(std::move(device), authenticate_task(), false);
+}
+
+auto sokketter::authenticate_async(
+    std::shared_ptr<power_strip> device, completion_callback completion_cb) -> void
+{
+    run_device_task<bool>(std::move(device), authenticate_task(), false, std::move(completion_cb));
+}
+
+auto sokketter::power_all_async(std::shared_ptr<power_strip> device, const bool &on)
+    -> std::future<bool>
+{
+    return run_device_task<bool>(std::move(device), power_all_task(on), false);
+}
+
+auto sokketter::power_all_async(std::shared_ptr<power_strip> device, const bool &on,
+    completion_callback completion_cb) -> void
+{
+    run_device_task<bool>(std::move(device), power_all_task(on), false, std::move(completion_cb));
+}
+
+auto sokketter::status_all_async(std::shared_ptr<power_strip> device)
+    -> std::future<std::vector<bool>>
+{
+    return run_device_task<std::vector<bool>>(std::move(device), status_all_task(), {});
+}
+
+auto sokketter::status_all_async(
+    std::shared_ptr<power_strip> device, status_all_callback completion_cb) -> void
+{
+    run_device_task<std::vector<bool>>(
+        std::move(device), status_all_task(), {}, std::move(completion_cb));
+}
+
+auto reconcile_task(const std::string &device_id, const std::map<size_t, bool> &desired_states)
+    -> std::function<std::vector<sokketter::socket_reconciliation>(sokketter::power_strip &)>
+{
+    return [device_id, desired_states](sokketter::power_strip &device) {
+        std::vector<sokketter::socket_reconciliation> report;
+        std::vector<size_t> differing_entries;
+
+        /**
+         * @attention all states are read before the first write, so Ethernet power strips answer
+         * them with a single status query or from the cache.
+         */
+        for (const auto &[socket_index, is_powered_on] : desired_states)
+        {
+            sokketter::socket_reconciliation entry;
+            entry.device_id = device_id;
+            entry.socket_index = socket_index;
+            entry.is_powered_on = is_powered_on;
+
+            const auto &socket = device.socket(socket_index);
+            if (!socket.has_value())
+            {
+                entry.result = sokketter::reconciliation_result::UNKNOWN_SOCKET;
+            }
+            else
+            {
+                const auto &state = socket->get().state();
+                if (state.is_valid && state.is_powered_on == is_powered_on)
+                {
+                    entry.result = sokketter::reconciliation_result::UNCHANGED;
+                }
+                else
+                {
+                    differing_entries.push_back(report.size());
+                }
+            }
+
+            report.push_back(entry);
+        }
+
+        /**
+         * @attention the differing sockets are handed over together, so Ethernet power strips
+         * switch them with a single request.
+         */
+        std::map<size_t, bool> differing_states;
+        for (const auto &entry_index : differing_entries)
+        {
+            differing_states[report[entry_index].socket_index] = report[entry_index].is_powered_on;
+        }
+
+        const auto &switched_indices = device.power_sockets(differing_states);
+
+        std::vector<size_t> switched_entries;
+        for (const auto &entry_index : differing_entries)
+        {
+            if (std::find(switched_indices.begin(), switched_indices.end(),
+                    report[entry_index].socket_index) != switched_indices.end())
+            {
+                switched_entries.push_back(entry_index);
+            }
+        }
+
+        if (switched_entries.empty())
+        {
+            return report;
+        }
+
+        /**
+         * @attention switched states are written through to the cache, so it is dropped to read
+         * the states back from the power strip.
+         */
+        device.invalidate_socket_states();
+
+        for (const auto &entry_index : switched_entries)
+        {
+            auto &entry = report[entry_index];
+
+            const auto &state = device.socket(entry.socket_index)->get().state();
+            entry.result = state.is_valid && state.is_powered_on == entry.is_powered_on
+                               ? sokketter::reconciliation_result::SWITCHED
+                               : sokketter::reconciliation_result::FAILED;
+        }
+
+        return report;
+    };
+}
+
+auto sokketter::reconcile(const std::vector<std::shared_ptr<power_strip>> &devices,
+    const desired_socket_states &desired_states) -> std::vector<socket_reconciliation>
+{
+    std::vector<socket_reconciliation> report;
+    std::vector<std::future<std::vector<socket_reconciliation>>> device_reports;
+
+    for (const auto &[device_id, device_states] : desired_states)
+    {
+        const auto device = std::find_if(devices.begin(), devices.end(),
+            [&device_id = device_id](const std::shared_ptr<power_strip> &candidate) {
+                return candidate != nullptr && candidate->configuration().id == device_id;
+            });
+
+        std::vector<socket_reconciliation> failure_result;
+        for (const auto &[socket_index, is_powered_on] : device_states)
+        {
+            failure_result.push_back({device_id, socket_index, is_powered_on,
+                device == devices.end() ? reconciliation_result::UNKNOWN_DEVICE
+                                        : reconciliation_result::FAILED});
+        }
+
+        if (device == devices.end())
+        {
+            std::promise<std::vector<socket_reconciliation>> promise;
+            promise.set_value(std::move(failure_result));
+            device_reports.push_back(promise.get_future());
+            continue;
+        }
+
+        device_reports.push_back(run_device_task<std::vector<socket_reconciliation>>(
+            *device, reconcile_task(device_id, device_states), std::move(failure_result)));
+    }
+
+    for (auto &device_report : device_reports)
+    {
+        const auto &entries = device_report.get();
+        report.insert(report.end(), entries.begin(), entries.end());
+    }
+
+    return report;
+}
+
+auto sokketter::groups() -> std::vector<socket_group>
+{
+    return sokketter_core::instance().database().groups();
+}
+
+auto sokketter::save_group(const socket_group &group) -> void
+{
+    sokketter_core::instance().database().store_group(group);
+    sokketter_core::instance().database().save();
+}
+
+auto sokketter::forget_group(const std::string &name) -> bool
+{
+    if (!sokketter_core::instance().database().remove_group(name))
+    {
+        return false;
+    }
+
+    sokketter_core::instance().database().save();
+
+    return true;
+}
+
+auto sokketter::scenes() -> std::vector<socket_scene>
+{
+    return sokketter_core::instance().database().scenes();
+}
+
+auto sokketter::save_scene(const socket_scene &scene) -> void
+{
+    sokketter_core::instance().database().store_scene(scene);
+    sokketter_core::instance().database().save();
+}
+
+auto sokketter::forget_scene(const std::string &name) -> bool
+{
+    if (!sokketter_core::instance().database().remove_scene(name))
+    {
+        return false;
+    }
+
+    sokketter_core::instance().database().save();
+
+    return true;
+}
+
+auto sokketter::power_group(const std::vector<std::shared_ptr<power_strip>> &devices,
+    const std::string &name, const bool &on) -> std::vector<socket_reconciliation>
+{
+    const auto &stored_groups = groups();
+    const auto group = std::find_if(stored_groups.begin(), stored_groups.end(),
+        [&name](const socket_group &candidate) { return candidate.name == name; });
+    if (group == stored_groups.end())
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "No socket group named '{}' is stored.", name);
+        return {};
+    }
+
+    desired_socket_states desired_states;
+    for (const auto &socket : group->sockets)
+    {
+        desired_states[socket.device_id][socket.socket_index] = on;
+    }
+
+    return reconcile(devices, desired_states);
+}
+
+auto sokketter::apply_scene(const std::vector<std::shared_ptr<power_strip>> &devices,
+    const std::string &name) -> std::vector<socket_reconciliation>
+{
+    const auto &stored_scenes = scenes();
+    const auto scene = std::find_if(stored_scenes.begin(), stored_scenes.end(),
+        [&name](const socket_scene &candidate) { return candidate.name == name; });
+    if (scene == stored_scenes.end())
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "No scene named '{}' is stored.", name);
+        return {};
+    }
+
+    return reconcile(devices, scene->states);
+}
@@ -0,0 +1,243 @@
+#include "logging_callback_sink.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+auto logging_callbacks::deliver(const sokketter::callback_view_structure &view) const -> void
+{
+    if (view_cb != nullptr)
+    {
+        view_cb(view);
+        return;
+    }
+
+    if (response_cb != nullptr)
+    {
+        response_cb(sokketter::callback_response_structure{
+            view.level, view.file, view.line, view.function, std::string(view.message)});
+    }
+}
+
+logging_callback_sink::logging_callback_sink(logging_callbacks callbacks)
+    : m_callbacks(std::move(callbacks))
+{}
+
+auto logging_callback_sink::sink_it_(const spdlog::details::log_msg &msg) -> void
+{
+    m_callbacks.deliver(sokketter::callback_view_structure{sokketter::logging_level(msg.level),
+        msg.source.filename, msg.source.line, msg.source.funcname,
+        std::string_view(msg.payload.data(), msg.payload.size())});
+}
+
+auto logging_callback_sink::flush_() -> void {}
+
+async_logging_callback_sink::async_logging_callback_sink(
+    logging_callbacks callbacks, const size_t &queue_size)
+    : m_callbacks(std::move(callbacks))
+{
+    /**
+     * @attention the ring indexes records with a mask, so its size is rounded up to a power of two.
+     */
+    size_t capacity = 2;
+    while (capacity < queue_size)
+    {
+        capacity <<= 1;
+    }
+
+    m_mask = capacity - 1;
+    m_records = std::make_unique<log_record[]>(capacity);
+
+    for (size_t index = 0; index < capacity; ++index)
+    {
+        m_records[index].sequence.store(index, std::memory_order_relaxed);
+    }
+
+    m_dispatcher = std::thread(&async_logging_callback_sink::dispatch_loop, this);
+}
+
+async_logging_callback_sink::~async_logging_callback_sink()
+{
+    stop();
+}
+
+auto async_logging_callback_sink::log(const spdlog::details::log_msg &msg) -> void
+{
+    /**
+     * @attention counted before the running check, so stop() either sees this call or this call
+     * sees the sink stopped.
+     */
+    m_pushing_count.fetch_add(1);
+
+    if (!m_is_running.load())
+    {
+        m_pushing_count.fetch_sub(1);
+        return;
+    }
+
+    const bool is_pushed = try_push(msg);
+    m_pushing_count.fetch_sub(1);
+
+    if (!is_pushed)
+    {
+        m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    m_wakeup.notify_one();
+}
+
+auto async_logging_callback_sink::flush() -> void
+{
+    const size_t position = m_enqueue_position.load(std::memory_order_acquire);
+
+    m_wakeup.notify_one();
+
+    std::unique_lock<std::mutex> lock(m_wakeup_mutex);
+    m_delivered.wait(lock, [this, position]() {
+        return !m_is_running.load(std::memory_order_acquire) ||
+               m_dequeue_position.load(std::memory_order_acquire) >= position;
+    });
+}
+
+auto async_logging_callback_sink::set_pattern(const std::string &) -> void {}
+
+auto async_logging_callback_sink::set_formatter(std::unique_ptr<spdlog::formatter>) -> void {}
+
+auto async_logging_callback_sink::stop() -> void
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_wakeup_mutex);
+        m_is_running.store(false);
+    }
+
+    m_wakeup.notify_all();
+    m_delivered.notify_all();
+
+    if (m_dispatcher.joinable())
+    {
+        m_dispatcher.join();
+    }
+
+    /**
+     * @brief messages pushed while the dispatcher was finishing are delivered here, once no
+     * log() call can push anymore.
+     */
+    while (m_pushing_count.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    deliver_queued();
+}
+
+auto async_logging_callback_sink::try_push(const spdlog::details::log_msg &msg) -> bool
+{
+    log_record *record = nullptr;
+    size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        record = &m_records[position & m_mask];
+
+        const size_t sequence = record->sequence.load(std::memory_order_acquire);
+        const auto difference =
+            static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueue_position.compare_exchange_weak(
+                    position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->level = sokketter::logging_level(msg.level);
+    record->file = msg.source.filename;
+    record->line = msg.source.line;
+    record->function = msg.source.funcname;
+    record->length = std::min(msg.payload.size(), MESSAGE_CAPACITY);
+    std::memcpy(record->message.data(), msg.payload.data(), record->length);
+
+    record->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+auto async_logging_callback_sink::try_pop() -> bool
+{
+    const size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    log_record &record = m_records[position & m_mask];
+
+    if (record.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return false;
+    }
+
+    m_callbacks.deliver(sokketter::callback_view_structure{record.level, record.file, record.line,
+        record.function, std::string_view(record.message.data(), record.length)});
+
+    record.sequence.store(position + m_mask + 1, std::memory_order_release);
+    m_dequeue_position.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+auto async_logging_callback_sink::deliver_queued() -> bool
+{
+    bool is_delivered = false;
+    while (try_pop())
+    {
+        is_delivered = true;
+    }
+
+    const size_t dropped_count = m_dropped_count.exchange(0, std::memory_order_relaxed);
+    if (dropped_count > 0)
+    {
+        const std::string message = std::to_string(dropped_count) +
+                                    " log messages were dropped, the logging queue was full.";
+        m_callbacks.deliver(sokketter::callback_view_structure{
+            sokketter::logging_level::WARN, __FILE__, __LINE__, __func__, message});
+    }
+
+    return is_delivered;
+}
+
+auto async_logging_callback_sink::dispatch_loop() -> void
+{
+    while (true)
+    {
+        if (deliver_queued())
+        {
+            {
+                const std::lock_guard<std::mutex> lock(m_wakeup_mutex);
+                m_delivered.notify_all();
+            }
+
+            continue;
+        }
+
+        if (!m_is_running.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeup_mutex);
+        m_wakeup.wait_for(lock, std::chrono::milliseconds(10), [this]() {
+            return !m_is_running.load(std::memory_order_acquire) ||
+                   m_dequeue_position.load(std::memory_order_relaxed) !=
+                       m_enqueue_position.load(std::memory_order_relaxed);
+        });
+    }
+}
@@ -0,0 +1,130 @@
+#ifndef LOGGING_CALLBACK_SINK_H
+#define LOGGING_CALLBACK_SINK_H
+
+#pragma once
+
+#include <libsokketter.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief host logging callbacks captured once when the sink is created.
+ */
+struct logging_callbacks
+{
+    std::function<void(sokketter::callback_response_structure)> response_cb = nullptr;
+    std::function<void(const sokketter::callback_view_structure &)> view_cb = nullptr;
+
+    auto deliver(const sokketter::callback_view_structure &view) const -> void;
+};
+
+/**
+ * @brief sink calling the host logging callback on the logging thread.
+ */
+class logging_callback_sink final : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+    explicit logging_callback_sink(logging_callbacks callbacks);
+
+protected:
+    auto sink_it_(const spdlog::details::log_msg &msg) -> void override;
+    auto flush_() -> void override;
+
+private:
+    logging_callbacks m_callbacks;
+};
+
+/**
+ * @brief sink queueing messages into a bounded lock-free ring that a dispatcher thread delivers to
+ * the host logging callback.
+ *
+ * Logging threads never wait for the host: when the ring is full the message is dropped and
+ * counted instead.
+ */
+class async_logging_callback_sink final : public spdlog::sinks::sink
+{
+public:
+    inline static constexpr size_t MESSAGE_CAPACITY = 512;
+
+    async_logging_callback_sink(logging_callbacks callbacks, const size_t &queue_size);
+    ~async_logging_callback_sink() override;
+
+    auto log(const spdlog::details::log_msg &msg) -> void override;
+
+    /**
+     * @brief waits until all messages queued before the call are delivered.
+     */
+    auto flush() -> void override;
+
+    /**
+     * @brief ignored, the host callback receives the raw message with the level and the source
+     * location as separate fields, so there is nothing to format.
+     */
+    auto set_pattern(const std::string &pattern) -> void override;
+    auto set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) -> void override;
+
+    /**
+     * @brief stops the dispatcher and delivers all queued messages, including the ones pushed
+     * while it was stopping.
+     * @attention messages logged afterwards are dropped.
+     */
+    auto stop() -> void;
+
+private:
+    struct log_record
+    {
+        std::atomic_size_t sequence = 0;
+        sokketter::logging_level level = sokketter::logging_level::ERR;
+        const char *file = nullptr;
+        int line = 0;
+        const char *function = nullptr;
+        size_t length = 0;
+        std::array<char, MESSAGE_CAPACITY> message = {};
+    };
+
+    logging_callbacks m_callbacks;
+
+    size_t m_mask = 0;
+    std::unique_ptr<log_record[]> m_records;
+
+    std::atomic_size_t m_enqueue_position = 0;
+    std::atomic_size_t m_dequeue_position = 0;
+    std::atomic_size_t m_dropped_count = 0;
+
+    std::atomic_bool m_is_running = true;
+
+    /**
+     * @brief number of log() calls past the running check, stop() waits for them before the last
+     * delivery so no message is pushed after it.
+     */
+    std::atomic_size_t m_pushing_count = 0;
+
+    std::mutex m_wakeup_mutex;
+    std::condition_variable m_wakeup;
+
+    /**
+     * @brief signalled by the dispatcher after delivering, woken up by flush().
+     */
+    std::condition_variable m_delivered;
+
+    std::thread m_dispatcher;
+
+    auto try_push(const spdlog::details::log_msg &msg) -> bool;
+    auto try_pop() -> bool;
+
+    /**
+     * @brief delivers the queued messages and reports the dropped ones.
+     * @return true if anything was delivered, false otherwise.
+     */
+    auto deliver_queued() -> bool;
+    auto dispatch_loop() -> void;
+};
+
+#endif // LOGGING_CALLBACK_SINK_H
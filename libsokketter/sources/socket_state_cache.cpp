@@ -0,0 +1,102 @@
+#include "socket_state_cache.h"
+
+#include <sokketter_core.h>
+
+auto socket_state_cache::find(const std::string &device_id, const size_t &index,
+    sokketter::socket_state &state) -> lookup_result
+{
+    const auto mode = sokketter_core::instance().socket_state_cache_mode();
+    if (mode == sokketter::socket_state_cache_mode::ALWAYS_READ)
+    {
+        return lookup_result::MISSING;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_entries.find(index);
+    if (it == m_entries.end())
+    {
+        return lookup_result::MISSING;
+    }
+
+    state.is_powered_on = it->second.is_powered_on;
+    state.is_valid = true;
+    state.age = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - it->second.stored_at);
+
+    if (mode == sokketter::socket_state_cache_mode::TRUST_LAST_WRITE ||
+        state.age < sokketter_core::instance().socket_state_cache_ttl(device_id))
+    {
+        return lookup_result::FRESH;
+    }
+
+    return mode == sokketter::socket_state_cache_mode::STALE_WHILE_REVALIDATE
+               ? lookup_result::STALE
+               : lookup_result::MISSING;
+}
+
+auto socket_state_cache::store(const size_t &index, const bool &is_powered_on) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[index] = {is_powered_on, std::chrono::steady_clock::now()};
+    m_last_known[index] = is_powered_on;
+}
+
+auto socket_state_cache::store(const std::vector<bool> &states) -> void
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t index = 0; index < states.size(); ++index)
+    {
+        m_entries[index + 1] = {states[index], now};
+        m_last_known[index + 1] = states[index];
+    }
+}
+
+auto socket_state_cache::invalidate() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+auto socket_state_cache::last_known(const size_t &index, bool &is_powered_on) const -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_last_known.find(index);
+    if (it == m_last_known.end())
+    {
+        return false;
+    }
+
+    is_powered_on = it->second;
+
+    return true;
+}
+
+auto socket_state_cache::restore_last_known(const std::map<size_t, bool> &states) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_last_known = states;
+}
+
+auto socket_state_cache::begin_refresh() -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_is_refreshing)
+    {
+        return false;
+    }
+
+    m_is_refreshing = true;
+
+    return true;
+}
+
+auto socket_state_cache::end_refresh() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_is_refreshing = false;
+}
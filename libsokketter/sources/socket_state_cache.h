@@ -0,0 +1,97 @@
+#ifndef SOCKET_STATE_CACHE_H
+#define SOCKET_STATE_CACHE_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief socket states of a single power strip kept in memory, written through on every
+ * successful switch and served according to settings_structure::socket_state_cache_mode.
+ */
+class socket_state_cache
+{
+public:
+    /**
+     * @brief the enum specifying outcomes of a cache lookup.
+     */
+    enum class lookup_result
+    {
+        /**
+         * @brief the state has to be read from the power strip.
+         */
+        MISSING,
+
+        FRESH,
+
+        /**
+         * @brief the state may be used, but has to be read again in the background.
+         */
+        STALE
+    };
+
+    /**
+     * @brief looks up the state of the socket.
+     * @param device_id selects the TTL override of the power strip.
+     * @param index of the socket as used by the driver.
+     * @param state receives the cached state and its age unless the result is MISSING.
+     */
+    auto find(const std::string &device_id, const size_t &index, sokketter::socket_state &state)
+        -> lookup_result;
+
+    auto store(const size_t &index, const bool &is_powered_on) -> void;
+
+    /**
+     * @brief stores the states of all sockets, the first state belongs to socket 1.
+     */
+    auto store(const std::vector<bool> &states) -> void;
+
+    /**
+     * @brief drops the cached states, the last known states are kept.
+     */
+    auto invalidate() -> void;
+
+    /**
+     * @brief gets the state the socket was last read in or switched to.
+     * @return false if the state was never seen, true otherwise.
+     */
+    auto last_known(const size_t &index, bool &is_powered_on) const -> bool;
+
+    /**
+     * @brief replaces the last known states, e.g. with the ones restored from the device database.
+     */
+    auto restore_last_known(const std::map<size_t, bool> &states) -> void;
+
+    /**
+     * @brief marks a background refresh as running.
+     * @return false if one is running already, true otherwise.
+     */
+    auto begin_refresh() -> bool;
+    auto end_refresh() -> void;
+
+private:
+    struct entry
+    {
+        bool is_powered_on = false;
+        std::chrono::steady_clock::time_point stored_at{};
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<size_t, entry> m_entries;
+
+    /**
+     * @brief outlive invalidations and restarts, so they only serve as a hint until the state is
+     * read again.
+     */
+    std::map<size_t, bool> m_last_known;
+    bool m_is_refreshing = false;
+};
+
+#endif // SOCKET_STATE_CACHE_H
@@ -0,0 +1,121 @@
+#include "sockstates_scanner.h"
+
+#include <array>
+
+auto sockstates_scanner::feed(std::string_view chunk) -> bool
+{
+    for (const char character : chunk)
+    {
+        switch (m_stage)
+        {
+        case stage::MARKER: {
+            while (m_matched_length > 0 && MARKER[m_matched_length] != character)
+            {
+                m_matched_length = marker_border(m_matched_length);
+            }
+
+            if (MARKER[m_matched_length] == character)
+            {
+                m_matched_length++;
+            }
+
+            if (m_matched_length == MARKER.size())
+            {
+                m_stage = stage::OPEN_BRACKET;
+            }
+            break;
+        }
+        case stage::OPEN_BRACKET: {
+            if (character == '[')
+            {
+                m_stage = stage::LIST;
+            }
+            break;
+        }
+        case stage::LIST: {
+            if (character == ',' || character == ']')
+            {
+                complete_entry();
+
+                if (character == ']')
+                {
+                    m_stage = stage::COMPLETE;
+                    return true;
+                }
+            }
+            else if (character != ' ' && character != '\t' && character != '\r' &&
+                     character != '\n')
+            {
+                m_is_entry_powered_on = m_entry_length == 0 && character == '1';
+                m_entry_length++;
+            }
+            break;
+        }
+        case stage::COMPLETE: {
+            return true;
+        }
+        }
+    }
+
+    return is_complete();
+}
+
+auto sockstates_scanner::is_complete() const -> bool
+{
+    return m_stage == stage::COMPLETE;
+}
+
+auto sockstates_scanner::states() const -> const std::vector<bool> &
+{
+    return m_states;
+}
+
+auto sockstates_scanner::reset() -> void
+{
+    m_stage = stage::MARKER;
+    m_matched_length = 0;
+    m_entry_length = 0;
+    m_is_entry_powered_on = false;
+    m_states.clear();
+}
+
+auto sockstates_scanner::complete_entry() -> void
+{
+    /**
+     * @attention blank entries, e.g. after a trailing comma, do not belong to any socket.
+     */
+    if (m_entry_length > 0)
+    {
+        m_states.push_back(m_entry_length == 1 && m_is_entry_powered_on);
+    }
+
+    m_entry_length = 0;
+    m_is_entry_powered_on = false;
+}
+
+auto sockstates_scanner::marker_border(const size_t &length) -> size_t
+{
+    static const auto borders = []() {
+        std::array<size_t, MARKER.size() + 1> table{};
+
+        size_t border = 0;
+        for (size_t index = 1; index < MARKER.size(); ++index)
+        {
+            while (border > 0 && MARKER[index] != MARKER[border])
+            {
+                border = table[border];
+            }
+
+            if (MARKER[index] == MARKER[border])
+            {
+                border++;
+            }
+
+            table[index + 1] = border;
+        }
+
+        return table;
+    }();
+
+    return borders[length];
+}
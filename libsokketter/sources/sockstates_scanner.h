@@ -0,0 +1,66 @@
+#ifndef SOCKSTATES_SCANNER_H
+#define SOCKSTATES_SCANNER_H
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief extracts the socket states from the "sockstates = [x,x,x,x]" declaration of the status
+ * page of Energenie LAN power strips, chunk by chunk as the page arrives.
+ *
+ * The declaration may be split across chunks at any byte, so the scanner keeps only the progress
+ * of the marker match and of the current list entry instead of buffering the page.
+ */
+class sockstates_scanner
+{
+public:
+    /**
+     * @brief scans the next chunk of the page.
+     * @return true once the closing bracket of the list was read, false otherwise.
+     */
+    auto feed(std::string_view chunk) -> bool;
+
+    [[nodiscard]] auto is_complete() const -> bool;
+
+    /**
+     * @brief gets the states read so far, the first state belongs to socket 1.
+     */
+    [[nodiscard]] auto states() const -> const std::vector<bool> &;
+
+    auto reset() -> void;
+
+private:
+    enum class stage
+    {
+        MARKER,
+        OPEN_BRACKET,
+        LIST,
+        COMPLETE
+    };
+
+    inline static constexpr std::string_view MARKER = "sockstates = ";
+
+    stage m_stage = stage::MARKER;
+    size_t m_matched_length = 0;
+
+    /**
+     * @brief non-blank characters of the current list entry, "1" is the only one powered on.
+     */
+    size_t m_entry_length = 0;
+    bool m_is_entry_powered_on = false;
+
+    std::vector<bool> m_states;
+
+    auto complete_entry() -> void;
+
+    /**
+     * @brief gets the length of the longest proper prefix of the marker that is also a suffix of
+     * its first given characters, used to continue matching after a mismatch.
+     */
+    static auto marker_border(const size_t &length) -> size_t;
+};
+
+#endif // SOCKSTATES_SCANNER_H
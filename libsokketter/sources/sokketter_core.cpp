@@ -1,8 +1,11 @@
 #include "sokketter_core.h"
 
+#include <call_context.h>
+#include <devices/energenie_eg_pmxx_lan.h>
 #include <devices/power_strip_base.h>
 #include <devices/power_strip_factory.h>
 #include <devices/test_device.h>
+#include <ethernet_communication.h>
 #include <libsokketter.h>
 
 #include <algorithm>
@@ -11,13 +14,18 @@
 #include <cstdlib>
 #include <ctime>
 #include <curl/curl.h>
+#include <exception>
+#include <future>
 #include <iomanip>
 #include <json/json.hpp>
-#include <spdlog/sinks/callback_sink.h>
+#include <set>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <sstream>
+#include <string_view>
 #include <third-party/kommpot/libkommpot/include/libkommpot.h>
+#include <type_traits>
+#include <variant>
 
 #ifdef _WIN32
 #    include <spdlog/sinks/msvc_sink.h>
@@ -33,54 +41,21 @@
 
 auto sokketter_core::initialize() -> bool
 {
-    const auto &shared_data_folder_path = sokketter::storage_path();
-    if (!std::filesystem::exists(shared_data_folder_path))
-    {
-        SPDLOG_DEBUG("No application data storage folder at '{}' was found, creating one.",
-            shared_data_folder_path.string());
-
-        std::error_code error_code;
-        if (!std::filesystem::create_directories(shared_data_folder_path, error_code))
-        {
-            SPDLOG_CRITICAL("Failed creating storage directory at '{}' with error '{}'!",
-                shared_data_folder_path.string(), error_code.message());
-            return false;
-        }
-
-        SPDLOG_DEBUG("Folder was created.");
-    }
-
-    const auto &logs_folder_path = sokketter::logs_path();
-    if (!std::filesystem::exists(logs_folder_path))
-    {
-        SPDLOG_DEBUG("No logs folder at '{}' was found, creating one.", logs_folder_path.string());
-
-        std::error_code error_code;
-        if (!std::filesystem::create_directories(logs_folder_path, error_code))
-        {
-            SPDLOG_CRITICAL("Failed creating logs directory at '{}' with error '{}'!",
-                logs_folder_path.string(), error_code.message());
-            return false;
-        }
-
-        SPDLOG_DEBUG("Folder was created.");
-    }
-
-    initialize_logger();
-
-    if (!kommpot::initialize())
-    {
-        SPDLOG_CRITICAL("Failed initializing kommpot library!");
-        return false;
-    }
-
-    m_database.load();
-
+    /**
+     * @attention the logger, kommpot and the device database are initialized on their first use,
+     * so commands that never touch a power strip do not pay for creating the storage folders,
+     * opening syslog, USB enumeration setup and database parsing.
+     */
     return true;
 }
 
 auto sokketter_core::deinitialize() -> bool
 {
+    /**
+     * @brief abort a running update check instead of waiting for the request to time out.
+     */
+    m_update_check_abort.store(true);
+
     {
         const std::lock_guard<std::mutex> lock(m_update_check_thread_mutex);
         if (m_update_check_thread.joinable())
@@ -89,31 +64,83 @@ auto sokketter_core::deinitialize() -> bool
         }
     }
 
-    m_database.save();
+    m_update_check_abort.store(false);
+
+    /**
+     * @brief asynchronous device tasks still hold the devices and their communications, so they
+     *        have to complete before kommpot and the database are released. A running Ethernet
+     *        discovery is aborted instead of sweeping the remaining hosts.
+     */
+    m_discovery_abort.store(true);
+    m_device_io_abort.store(true);
+    m_io_pool.stop();
+    m_device_io_abort.store(false);
+    m_discovery_abort.store(false);
+
+    m_io_trace.stop();
 
     /**
      * @brief wait for any ongoing device enumeration to finish before releasing the devices,
      *        otherwise the enumeration thread accesses the database while it is being cleared.
+     * @attention the subsystems lock is not held here, because the enumeration thread may still
+     *            need it to load the database.
      */
-    kommpot::deinitialize();
+    if (m_is_kommpot_initialized.exchange(false))
+    {
+        kommpot::deinitialize();
+    }
+
+    /**
+     * @attention devices may be replugged while no scan is running, so the serial numbers are
+     * read again after the next initialization.
+     */
+    m_serial_cache.clear();
+
+    const std::lock_guard<std::mutex> lock(m_subsystems_mutex);
+
+    if (m_is_database_loaded.load())
+    {
+        m_database.save();
+    }
 
     m_database.release_resources();
+    m_is_database_loaded.store(false);
 
-    deinitialize_logger();
+    {
+        const std::lock_guard<std::mutex> logger_lock(m_logger_mutex);
+        deinitialize_logger();
+        m_is_logger_started.store(false, std::memory_order_release);
+    }
 
     return true;
 }
 
 auto sokketter_core::settings() noexcept -> sokketter::settings_structure
 {
+    const std::lock_guard<std::mutex> lock(m_settings_mutex);
     return m_settings;
 }
 
 auto sokketter_core::set_settings(const sokketter::settings_structure &settings) noexcept -> void
 {
-    m_settings = settings;
+    {
+        const std::lock_guard<std::mutex> lock(m_settings_mutex);
+        m_settings = settings;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(m_device_settings_mutex);
+        m_socket_state_cache_mode = settings.socket_state_cache_mode;
+        m_socket_state_cache_ttl_msec = settings.socket_state_cache_ttl_msec;
+        m_socket_state_cache_ttl_msec_by_device = settings.socket_state_cache_ttl_msec_by_device;
+        m_usb_retry_policy = settings.usb_retry_policy;
+        m_ethernet_retry_policy = settings.ethernet_retry_policy;
+        m_is_ethernet_status_hedging_enabled = settings.is_ethernet_status_hedging_enabled;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_logger_mutex);
 
-    if (m_settings.logging_level == sokketter::logging_level::OFF)
+    if (settings.logging_level == sokketter::logging_level::OFF)
     {
         deinitialize_logger();
     }
@@ -121,132 +148,512 @@ auto sokketter_core::set_settings(const sokketter::settings_structure &settings)
     {
         initialize_logger();
     }
+
+    m_is_logger_started.store(true, std::memory_order_release);
+}
+
+auto sokketter_core::start_logger() -> void
+{
+    if (m_is_logger_started.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_logger_mutex);
+    if (!m_is_logger_started.load(std::memory_order_relaxed))
+    {
+        initialize_logger();
+        m_is_logger_started.store(true, std::memory_order_release);
+    }
 }
 
 auto sokketter_core::database() -> database_storage &
 {
+    start_logger();
+
+    if (!m_is_database_loaded.load(std::memory_order_acquire))
+    {
+        const std::lock_guard<std::mutex> lock(m_subsystems_mutex);
+        if (!m_is_database_loaded.load(std::memory_order_relaxed))
+        {
+            m_database.load();
+            connect_registered_devices();
+            m_is_database_loaded.store(true, std::memory_order_release);
+        }
+    }
+
     return m_database;
 }
 
+auto sokketter_core::connect_registered_devices() -> void
+{
+    /**
+     * @attention registered power strips are driven over HTTP by their address, so their
+     * communication is built without contacting them.
+     */
+    const auto devices = m_database.get();
+    for (const auto &device : *devices)
+    {
+        auto *base = dynamic_cast<power_strip_base *>(device.get());
+        if (base == nullptr || !device->configuration().is_registered ||
+            device->configuration().address.empty())
+        {
+            continue;
+        }
+
+        base->reconnect(std::make_shared<ethernet_communication>(device->configuration().address,
+            energenie_eg_pmxx_lan::identification().port, device->configuration().id));
+    }
+}
+
+auto sokketter_core::add_ethernet_device(const std::string &ip, const std::string &mac,
+    const std::string &password) -> std::shared_ptr<sokketter::power_strip>
+{
+    if (!lan_discovery::is_ipv4_address(ip))
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "'{}' is not a valid IPv4 address!", ip);
+        return nullptr;
+    }
+
+    std::string normalized_mac;
+    if (!lan_discovery::normalize_mac(mac, normalized_mac))
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "'{}' is not a valid MAC address!", mac);
+        return nullptr;
+    }
+
+    const auto communication = std::make_shared<ethernet_communication>(
+        ip, energenie_eg_pmxx_lan::identification().port, normalized_mac);
+
+    merge_communications({communication});
+
+    auto device = this->device(normalized_mac);
+    if (device == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "Failed adding the Ethernet device {}!", normalized_mac);
+        return nullptr;
+    }
+
+    auto *base = dynamic_cast<power_strip_base *>(device.get());
+    if (base == nullptr)
+    {
+        SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
+            "{}: failed casting the device to power_strip_base!", device->to_string());
+        return nullptr;
+    }
+
+    base->set_registered(true);
+
+    if (!password.empty())
+    {
+        auto configuration = device->configuration();
+        configuration.authentication.password = password;
+        device->configure(configuration);
+    }
+
+    database().save();
+
+    SPDLOG_LOGGER_INFO(
+        SOKKETTER_LOGGER, "{}: added with fixed address {}.", device->to_string(), ip);
+
+    return device;
+}
+
+auto sokketter_core::initialize_kommpot() -> bool
+{
+    start_logger();
+
+    const std::lock_guard<std::mutex> lock(m_subsystems_mutex);
+
+    if (m_is_kommpot_initialized.load())
+    {
+        return true;
+    }
+
+    if (!kommpot::initialize())
+    {
+        SPDLOG_LOGGER_CRITICAL(SOKKETTER_LOGGER, "Failed initializing kommpot library!");
+        return false;
+    }
+
+    m_is_kommpot_initialized.store(true);
+
+    apply_kommpot_settings();
+
+    return true;
+}
+
 auto sokketter_core::devices(const sokketter::device_filter &filter)
     -> const std::vector<std::shared_ptr<sokketter::power_strip>> &
 {
-    auto &database = sokketter_core::instance().database().get();
-
-    const auto supported_devices = power_strip_factory::supported_devices(filter);
+    auto supported_devices = power_strip_factory::supported_devices(filter);
 
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Supported devices: {}.", supported_devices.size());
 
+    thread_local std::shared_ptr<const database_storage::device_list> pinned_devices;
+
+    if (!initialize_kommpot())
+    {
+        pinned_devices = database().get();
+        return *pinned_devices;
+    }
+
+    /**
+     * @brief the library discovers the Ethernet power strips while kommpot enumerates the rest.
+     */
+    std::future<std::vector<std::shared_ptr<kommpot::device_communication>>> ethernet_devices;
+    if (is_ethernet_discovery_enabled(filter))
+    {
+        if (is_ethernet_sweep_configured())
+        {
+            remove_ethernet_identifications(supported_devices);
+        }
+
+        ethernet_devices = std::async(std::launch::async, [this]() {
+            std::vector<std::shared_ptr<kommpot::device_communication>> communications;
+            discover_ethernet_devices(
+                [&communications](std::shared_ptr<kommpot::device_communication> communication) {
+                    communications.push_back(std::move(communication));
+                });
+            return communications;
+        });
+    }
+
+    m_serial_cache.begin_scan();
+
     auto communications = kommpot::devices(supported_devices);
 
-    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Connected devices: {}.", communications.size());
+    if (ethernet_devices.valid())
+    {
+        const auto discovered = ethernet_devices.get();
+        communications.insert(communications.end(), discovered.begin(), discovered.end());
+    }
+
+    /**
+     * @attention the returned reference must outlive later rescans, so the snapshot it points
+     * into is pinned per thread until the same thread asks for the devices again.
+     */
+    pinned_devices = merge_communications(communications);
+
+    m_serial_cache.end_scan();
+
+    warm_up_ethernet_devices(*pinned_devices);
+
+    return *pinned_devices;
+}
 
-    for (auto &communication : communications)
+auto sokketter_core::devices(const sokketter::device_filter &filter,
+    sokketter::device_callback device_cb, sokketter::status_callback status_cb) -> void
+{
     {
-        auto device = power_strip_factory::create(communication);
-        if (!device)
+        const std::lock_guard<std::mutex> lock(m_callbacks_mutex);
+        m_device_cb = device_cb;
+        m_status_cb = status_cb;
+    }
+
+    auto supported_devices = power_strip_factory::supported_devices(filter);
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Supported devices: {}.", supported_devices.size());
+
+    if (!initialize_kommpot())
+    {
+        if (status_cb != nullptr)
         {
-            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "Failed creating the device!");
-            continue;
+            status_cb(sokketter::enumeration_status::COMPLETED);
         }
+        return;
+    }
 
-        auto baseDevice = dynamic_cast<sokketter::power_strip *>(device.get());
-        if (baseDevice == nullptr)
+    const bool is_discovering_ethernet = is_ethernet_discovery_enabled(filter);
+
+    /**
+     * @brief completion is reported once both kommpot and the library discovery are finished.
+     */
+    m_pending_enumerations.store(is_discovering_ethernet ? 2 : 1);
+
+    if (is_discovering_ethernet)
+    {
+        if (is_ethernet_sweep_configured())
         {
-            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
-                "{}: failed casting the device to power_strip_base!", device->to_string());
-            continue;
+            remove_ethernet_identifications(supported_devices);
         }
 
-        /**
-         * @brief look for saved configuration of this device.
-         */
-        auto it = std::find_if(database.begin(), database.end(),
-            [&](const std::shared_ptr<sokketter::power_strip> &item) {
-                return item->configuration().id == device->configuration().id;
-            });
+        m_io_pool.submit([this]() {
+            new_status_received(kommpot::enumeration_status::ENUMERATING_ETHERNET_DEVICES);
+
+            discover_ethernet_devices(
+                [this](std::shared_ptr<kommpot::device_communication> communication) {
+                    new_devices_received({std::move(communication)});
+                });
+
+            new_status_received(kommpot::enumeration_status::COMPLETED);
+        });
+    }
 
-        if (it != database.end())
+    m_serial_cache.begin_scan();
+
+    kommpot::devices(supported_devices,
+        std::bind(&sokketter_core::new_devices_received, this, std::placeholders::_1),
+        std::bind(&sokketter_core::new_status_received, this, std::placeholders::_1));
+}
+
+auto sokketter_core::is_ethernet_discovery_enabled(const sokketter::device_filter &filter) const
+    -> bool
+{
+    using underlying = std::underlying_type_t<sokketter::power_strip_type>;
+
+    const bool is_included =
+        (static_cast<underlying>(filter.included_types) &
+            static_cast<underlying>(sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN)) != 0;
+
+    /**
+     * @brief known addresses and neighbours are probed whenever the neighbour table is available,
+     *        the subnets are only an optional fallback.
+     */
+    return is_included &&
+           (lan_discovery::is_neighbour_table_available() || is_ethernet_sweep_configured());
+}
+
+auto sokketter_core::is_ethernet_sweep_configured() const -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_settings_mutex);
+    return !m_settings.ethernet_discovery_subnets.empty();
+}
+
+auto sokketter_core::warm_up_ethernet_devices(const database_storage::device_list &devices)
+    -> void
+{
+    const auto settings = this->settings();
+
+    if (!settings.is_ethernet_warm_up_enabled ||
+        socket_state_cache_mode() == sokketter::socket_state_cache_mode::ALWAYS_READ)
+    {
+        return;
+    }
+
+    auto pending_devices = std::make_shared<database_storage::device_list>();
+    for (const auto &device : devices)
+    {
+        const auto &configuration = device->configuration();
+        if (configuration.type != sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN ||
+            configuration.authentication.password.empty() || !device->is_connected())
         {
-            auto baseIt = dynamic_cast<power_strip_base *>(it->get());
-            if (baseIt == nullptr)
+            continue;
+        }
+
+        pending_devices->push_back(device);
+    }
+
+    if (pending_devices->empty())
+    {
+        return;
+    }
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Warming up {} Ethernet power strips.",
+        pending_devices->size());
+
+    /**
+     * @attention each worker takes the next power strip until none is left, so no more than the
+     * configured number of power strips is accessed at the same time.
+     */
+    auto next_device = std::make_shared<std::atomic_size_t>(0);
+    const size_t worker_count = std::clamp<size_t>(
+        settings.ethernet_warm_up_concurrency, 1, pending_devices->size());
+
+    for (size_t worker = 0; worker < worker_count; ++worker)
+    {
+        execute([this, pending_devices, next_device]() {
+            for (size_t index = next_device->fetch_add(1); index < pending_devices->size();
+                 index = next_device->fetch_add(1))
             {
-                SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
-                    "{}: failed casting the device to power_strip_base!", device->to_string());
-                continue;
+                warm_up_ethernet_device(pending_devices->at(index));
             }
+        });
+    }
+}
 
-            baseIt->initialize(communication);
+auto sokketter_core::warm_up_ethernet_device(const std::shared_ptr<sokketter::power_strip> &device)
+    -> void
+{
+    if (m_device_io_abort.load() || device->sockets().empty())
+    {
+        return;
+    }
 
-            SPDLOG_LOGGER_DEBUG(
-                SOKKETTER_LOGGER, "{}: device was successfully created!", device->to_string());
-        }
-        else
-        {
-            /**
-             * @brief append basic device configuration if it is a first time.
-             */
-            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
-                "{}: new device was successfully created and added to database!",
-                device->to_string());
+    /**
+     * @attention a single status query refreshes the states of all sockets of the power strip,
+     * the driver serializes it with other I/O of the same power strip.
+     */
+    const auto &state = device->sockets().front().state();
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "{}: warm-up {}.", device->to_string(),
+        state.is_valid ? "succeeded" : "failed");
+}
+
+auto sokketter_core::remove_ethernet_identifications(
+    std::vector<kommpot::device_identification> &identifications) -> void
+{
+    identifications.erase(std::remove_if(identifications.begin(), identifications.end(),
+                              [](const kommpot::device_identification &identification) {
+                                  return std::holds_alternative<
+                                      kommpot::ethernet_device_identification>(identification);
+                              }),
+        identifications.end());
+}
+
+auto sokketter_core::known_ethernet_candidates() -> std::vector<lan_candidate>
+{
+    std::vector<lan_candidate> candidates;
+    std::set<std::string> addresses;
 
-            database.push_back(device);
+    /**
+     * @brief last known addresses go first, so known power strips answer before anything else.
+     */
+    const auto known_devices = database().get();
+    for (const auto &device : *known_devices)
+    {
+        if (device == nullptr ||
+            device->configuration().type != sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN ||
+            device->configuration().address.empty() || device->configuration().is_registered)
+        {
+            continue;
+        }
 
-            sokketter_core::instance().database().save();
+        if (addresses.insert(device->configuration().address).second)
+        {
+            candidates.push_back({device->configuration().address, device->configuration().id});
         }
     }
 
     /**
-     * Sort the database by device name.
+     * @brief the kernel has usually already resolved the power strips the host talked to, so
+     *        neighbours with the Energenie MAC prefix are probed before sweeping whole subnets.
      */
-    std::sort(database.begin(), database.end(),
-        [](const std::shared_ptr<sokketter::power_strip> &a,
-            const std::shared_ptr<sokketter::power_strip> &b) {
-            return a->configuration().name < b->configuration().name;
-        });
+    for (const auto &[ip, mac] : lan_discovery::neighbour_table())
+    {
+        const bool is_registered = std::any_of(known_devices->begin(), known_devices->end(),
+            [&mac = mac](const std::shared_ptr<sokketter::power_strip> &device) {
+                return device != nullptr && device->configuration().id == mac &&
+                       device->configuration().is_registered;
+            });
 
-    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Created devices: {}.", database.size());
+        if (!is_registered && lan_discovery::is_energenie_mac(mac) && addresses.insert(ip).second)
+        {
+            candidates.push_back({ip, mac});
+        }
+    }
 
-    return database;
+    return candidates;
 }
 
-auto sokketter_core::devices(const sokketter::device_filter &filter,
-    sokketter::device_callback device_cb, sokketter::status_callback status_cb) -> void
+auto sokketter_core::subnet_ethernet_candidates(const std::vector<std::string> &subnets,
+    const std::set<std::string> &probed_addresses) -> std::vector<lan_candidate>
 {
-    m_device_cb = device_cb;
-    m_status_cb = status_cb;
+    std::vector<lan_candidate> candidates;
+    std::set<std::string> addresses = probed_addresses;
 
-    const auto supported_devices = power_strip_factory::supported_devices(filter);
+    for (const auto &subnet : subnets)
+    {
+        std::vector<std::string> hosts;
+        if (!lan_discovery::subnet_hosts(subnet, hosts))
+        {
+            continue;
+        }
 
-    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Supported devices: {}.", supported_devices.size());
+        for (const auto &host : hosts)
+        {
+            if (addresses.insert(host).second)
+            {
+                candidates.push_back({host, ""});
+            }
+        }
+    }
 
-    kommpot::devices(supported_devices,
-        std::bind(&sokketter_core::new_devices_received, this, std::placeholders::_1),
-        std::bind(&sokketter_core::new_status_received, this, std::placeholders::_1));
+    return candidates;
+}
+
+auto sokketter_core::discover_ethernet_devices(
+    const std::function<void(std::shared_ptr<kommpot::device_communication>)> &found_cb) -> void
+{
+    const uint16_t port = energenie_eg_pmxx_lan::identification().port;
+    const auto settings = this->settings();
+
+    std::set<std::string> found_macs;
+
+    const auto report = [&](const lan_candidate &candidate) {
+        /**
+         * @attention a power strip answering on a new address is also listed under its old one
+         * until the database is refreshed, so each MAC is reported once.
+         */
+        if (!found_macs.insert(candidate.mac).second)
+        {
+            return;
+        }
+
+        found_cb(std::make_shared<ethernet_communication>(candidate.ip, port, candidate.mac));
+    };
+
+    const auto known_candidates = known_ethernet_candidates();
+
+    lan_discovery::probe(known_candidates, port, settings.ethernet_discovery_concurrency,
+        settings.ethernet_discovery_timeout_msec, m_discovery_abort, report);
+
+    /**
+     * @brief the subnets are only swept when a known power strip did not answer on its known
+     *        address, or when nothing was found at all.
+     */
+    const auto known_devices = database().get();
+    const bool is_known_device_missing = std::any_of(known_devices->begin(),
+        known_devices->end(), [&](const std::shared_ptr<sokketter::power_strip> &device) {
+            return device != nullptr &&
+                   device->configuration().type ==
+                       sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN &&
+                   !device->configuration().is_registered &&
+                   found_macs.count(device->configuration().id) == 0;
+        });
+
+    if (!found_macs.empty() && !is_known_device_missing)
+    {
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+            "All {} Ethernet power strips answered, skipping the subnet sweep.", found_macs.size());
+        return;
+    }
+
+    std::set<std::string> probed_addresses;
+    for (const auto &candidate : known_candidates)
+    {
+        probed_addresses.insert(candidate.ip);
+    }
+
+    lan_discovery::probe(
+        subnet_ethernet_candidates(settings.ethernet_discovery_subnets, probed_addresses), port,
+        settings.ethernet_discovery_concurrency, settings.ethernet_discovery_timeout_msec,
+        m_discovery_abort, report);
 }
 
 auto sokketter_core::device(const size_t &index) -> std::shared_ptr<sokketter::power_strip>
 {
-    auto &database = sokketter_core::instance().database().get();
+    const auto database = this->database().get();
 
-    if (index >= database.size())
+    if (index >= database->size())
     {
         SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
             "Failed creating the device - requested index {} is greater that the number of the "
             "devices ({})!",
-            index, database.size());
+            index, database->size());
         return nullptr;
     }
 
-    return database[index];
+    return (*database)[index];
 }
 
 auto sokketter_core::device(const std::string &serial_number)
     -> std::shared_ptr<sokketter::power_strip>
 {
-    auto &database = sokketter_core::instance().database().get();
+    const auto database = this->database().get();
 
-    for (const auto &device : database)
+    for (const auto &device : *database)
     {
         if (device && device->configuration().id == serial_number)
         {
@@ -259,6 +666,106 @@ auto sokketter_core::device(const std::string &serial_number)
     return nullptr;
 }
 
+auto sokketter_core::merge_communications(
+    const std::vector<std::shared_ptr<kommpot::device_communication>> &communications)
+    -> std::shared_ptr<const database_storage::device_list>
+{
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Connected devices: {}.", communications.size());
+
+    /**
+     * @attention device I/O happens against the current snapshot and outside of the writer lock,
+     * only the resulting list change is published under it.
+     */
+    const auto known_devices = database().get();
+    database_storage::device_list new_devices;
+
+    for (const auto &communication : communications)
+    {
+        auto device = power_strip_factory::create(communication);
+        if (!device)
+        {
+            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "Failed creating the device!");
+            continue;
+        }
+
+        /**
+         * @brief look for saved configuration of this device.
+         */
+        auto it = std::find_if(known_devices->begin(), known_devices->end(),
+            [&](const std::shared_ptr<sokketter::power_strip> &item) {
+                return item && item->configuration().id == device->configuration().id;
+            });
+
+        if (it != known_devices->end())
+        {
+            auto baseIt = dynamic_cast<power_strip_base *>(it->get());
+            if (baseIt == nullptr)
+            {
+                SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
+                    "{}: failed casting the device to power_strip_base!", device->to_string());
+                continue;
+            }
+
+            baseIt->reconnect(communication);
+            m_io_trace.record_device(**it);
+
+            SPDLOG_LOGGER_DEBUG(
+                SOKKETTER_LOGGER, "{}: device was successfully created!", device->to_string());
+        }
+        else
+        {
+            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+                "{}: new device was successfully created and added to database!",
+                device->to_string());
+
+            m_io_trace.record_device(*device);
+
+            new_devices.push_back(device);
+        }
+    }
+
+    /**
+     * @brief append basic device configuration if it is a first time and publish the list sorted
+     * by device name, so readers never observe a partially sorted one.
+     */
+    const auto database = this->database().update([&](database_storage::device_list &devices) {
+        for (const auto &device : new_devices)
+        {
+            const bool is_known = std::any_of(devices.begin(), devices.end(),
+                [&](const std::shared_ptr<sokketter::power_strip> &item) {
+                    return item && item->configuration().id == device->configuration().id;
+                });
+
+            if (!is_known)
+            {
+                devices.push_back(device);
+            }
+        }
+
+        std::sort(devices.begin(), devices.end(),
+            [](const std::shared_ptr<sokketter::power_strip> &a,
+                const std::shared_ptr<sokketter::power_strip> &b) {
+                return a->configuration().name < b->configuration().name;
+            });
+    });
+
+    if (!new_devices.empty())
+    {
+        m_database.save();
+    }
+
+    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Created devices: {}.", database->size());
+
+    return database;
+}
+
+auto update_check_progress(void *clientp, curl_off_t dltotal, curl_off_t dlnow,
+    curl_off_t ultotal, curl_off_t ulnow) -> int
+{
+    const auto *abort = static_cast<const std::atomic_bool *>(clientp);
+    return abort != nullptr && abort->load() ? 1 : 0;
+}
+
 auto sokketter_core::write_response_data(char *ptr, size_t size, size_t nmemb, void *userdata)
     -> size_t
 {
@@ -273,6 +780,33 @@ auto sokketter_core::write_response_data(char *ptr, size_t size, size_t nmemb, v
     return total_size;
 }
 
+auto sokketter_core::read_etag_header(char *buffer, size_t size, size_t nitems, void *userdata)
+    -> size_t
+{
+    auto *etag = static_cast<std::string *>(userdata);
+    const size_t length = size * nitems;
+
+    constexpr std::string_view ETAG_HEADER = "etag:";
+
+    std::string_view header(buffer, length);
+    if (etag != nullptr && header.size() > ETAG_HEADER.size() &&
+        std::equal(ETAG_HEADER.begin(), ETAG_HEADER.end(), header.begin(),
+            [](const char expected, const char actual) {
+                return std::tolower(static_cast<unsigned char>(actual)) == expected;
+            }))
+    {
+        header.remove_prefix(ETAG_HEADER.size());
+
+        const auto first = header.find_first_not_of(" \t");
+        const auto last = header.find_last_not_of(" \t\r\n");
+        *etag = first == std::string_view::npos
+                    ? std::string()
+                    : std::string(header.substr(first, last - first + 1));
+    }
+
+    return length;
+}
+
 auto sokketter_core::normalize_version_string(std::string version) -> std::string
 {
     while (!version.empty() && (version.front() == 'v' || version.front() == 'V'))
@@ -354,6 +888,13 @@ auto sokketter_core::release_link() -> std::string
     return RELEASE_LINK;
 }
 
+auto current_epoch_seconds() -> int64_t
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
 auto current_timestamp() -> std::string
 {
     const auto now = std::chrono::system_clock::now();
@@ -381,6 +922,8 @@ auto sokketter_core::check_for_update_async() -> void
         return;
     }
 
+    start_logger();
+
     const std::lock_guard<std::mutex> lock(m_update_check_thread_mutex);
 
     if (m_update_check_running.load())
@@ -395,6 +938,26 @@ auto sokketter_core::check_for_update_async() -> void
         m_update_check_thread.join();
     }
 
+    {
+        const std::lock_guard<std::mutex> storage_lock(m_update_check_storage_mutex);
+        m_update_check_storage.load();
+
+        const auto elapsed_sec =
+            current_epoch_seconds() - m_update_check_storage.get().attempted_at;
+        const auto interval_sec =
+            static_cast<int64_t>(this->settings().update_check_interval_sec);
+
+        /**
+         * @attention a negative elapsed time means the clock was moved back, the check is due then.
+         */
+        if (elapsed_sec >= 0 && elapsed_sec < interval_sec)
+        {
+            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+                "Skipping update check, the previous attempt was {} seconds ago.", elapsed_sec);
+            return;
+        }
+    }
+
     m_update_check_running.store(true);
 
     m_update_check_thread = std::thread([this]() {
@@ -409,20 +972,45 @@ auto sokketter_core::check_for_update_async() -> void
 
         update_check_running_guard running_guard{m_update_check_running};
 
-        std::string latest_version;
-        const bool has_update = is_new_release_available(latest_version);
-        if (!has_update && latest_version.empty())
+        update_check_storage::cached_status cached;
+
+        {
+            /**
+             * @attention the attempt is stored before the request, so machines without network
+             * access are not retried on every call while the request keeps failing.
+             */
+            const std::lock_guard<std::mutex> lock(m_update_check_storage_mutex);
+            m_update_check_storage.load();
+            cached = m_update_check_storage.get();
+
+            cached.attempted_at = current_epoch_seconds();
+            m_update_check_storage.set(cached);
+            m_update_check_storage.save();
+        }
+
+        /**
+         * @attention a 304 response carries no release, so the ETag is only useful together
+         * with the cached version it was received for.
+         */
+        std::string etag = cached.latest_version.empty() ? std::string() : cached.etag;
+        std::string latest_version = cached.latest_version;
+
+        const auto result = request_latest_release(etag, latest_version);
+        if (result == release_request_result::FAILED)
         {
             return;
         }
 
-        update_check_storage::cached_status result;
-        result.status.checked_at = current_timestamp();
-        result.status.new_version = has_update ? latest_version : std::string();
-        result.latest_version = latest_version;
+        const auto current_version = sokketter::version().to_string();
+
+        cached.status.checked_at = current_timestamp();
+        cached.status.new_version =
+            is_newer_version(current_version, latest_version) ? latest_version : std::string();
+        cached.latest_version = latest_version;
+        cached.etag = etag;
 
         const std::lock_guard<std::mutex> lock(m_update_check_storage_mutex);
-        m_update_check_storage.set(result);
+        m_update_check_storage.set(cached);
         m_update_check_storage.save();
     });
 }
@@ -444,21 +1032,220 @@ auto sokketter_core::last_update_check_status() -> sokketter::update_check_statu
     return result.status;
 }
 
+auto sokketter_core::set_executor(sokketter::executor executor) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_executor_mutex);
+    m_executor = std::move(executor);
+}
+
+auto sokketter_core::execute(std::function<void()> task) -> void
+{
+    task = [task = std::move(task), frame = call_context::current()]() {
+        const call_context::scope scope(frame);
+        task();
+    };
+
+    sokketter::executor executor = nullptr;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_executor_mutex);
+        executor = m_executor;
+    }
+
+    if (executor != nullptr)
+    {
+        executor(std::move(task));
+        return;
+    }
+
+    m_io_pool.submit(std::move(task));
+}
+
+auto sokketter_core::execute_serialized(const std::string &device_id, std::function<void()> task)
+    -> void
+{
+    task = [task = std::move(task), frame = call_context::current()]() {
+        const call_context::scope scope(frame);
+        task();
+    };
+
+    {
+        const std::lock_guard<std::mutex> lock(m_strands_mutex);
+
+        auto &strand = m_strands[device_id];
+        strand.tasks.push_back(std::move(task));
+
+        if (strand.is_running)
+        {
+            return;
+        }
+
+        strand.is_running = true;
+    }
+
+    execute([this, device_id]() { run_next_serialized(device_id); });
+}
+
+auto sokketter_core::run_next_serialized(const std::string &device_id) -> void
+{
+    std::function<void()> task = nullptr;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_strands_mutex);
+
+        auto &strand = m_strands[device_id];
+        task = std::move(strand.tasks.front());
+        strand.tasks.pop_front();
+    }
+
+    try
+    {
+        task();
+    }
+    catch (const std::exception &exception)
+    {
+        SPDLOG_LOGGER_ERROR(
+            SOKKETTER_LOGGER, "Asynchronous device task failed: {}.", exception.what());
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(m_strands_mutex);
+
+        const auto it = m_strands.find(device_id);
+        if (it->second.tasks.empty())
+        {
+            m_strands.erase(it);
+            return;
+        }
+    }
+
+    /**
+     * @attention the next task is queued behind the tasks of the other power strips instead of
+     * running on this worker right away, so a busy power strip cannot keep a worker to itself.
+     */
+    execute([this, device_id]() { run_next_serialized(device_id); });
+}
+
+auto sokketter_core::is_device_io_aborted() const -> bool
+{
+    return m_device_io_abort.load();
+}
+
+auto sokketter_core::io_trace() -> io_trace_recorder &
+{
+    return m_io_trace;
+}
+
+auto sokketter_core::serial_cache() -> usb_serial_cache &
+{
+    return m_serial_cache;
+}
+
+auto sokketter_core::socket_state_cache_mode() -> sokketter::socket_state_cache_mode
+{
+    const std::lock_guard<std::mutex> lock(m_device_settings_mutex);
+    return m_socket_state_cache_mode;
+}
+
+auto sokketter_core::socket_state_cache_ttl(const std::string &device_id)
+    -> std::chrono::milliseconds
+{
+    const std::lock_guard<std::mutex> lock(m_device_settings_mutex);
+
+    const auto it = m_socket_state_cache_ttl_msec_by_device.find(device_id);
+    if (it != m_socket_state_cache_ttl_msec_by_device.end())
+    {
+        return std::chrono::milliseconds(it->second);
+    }
+
+    return std::chrono::milliseconds(m_socket_state_cache_ttl_msec);
+}
+
+auto sokketter_core::usb_retry_policy() -> sokketter::retry_policy
+{
+    const std::lock_guard<std::mutex> lock(m_device_settings_mutex);
+    return m_usb_retry_policy;
+}
+
+auto sokketter_core::ethernet_retry_policy() -> sokketter::retry_policy
+{
+    const std::lock_guard<std::mutex> lock(m_device_settings_mutex);
+    return m_ethernet_retry_policy;
+}
+
+auto sokketter_core::is_ethernet_status_hedging_enabled() -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_device_settings_mutex);
+    return m_is_ethernet_status_hedging_enabled;
+}
+
+auto sokketter_core::start_io_trace(const std::filesystem::path &path) -> bool
+{
+    start_logger();
+
+    if (!m_io_trace.start(path))
+    {
+        return false;
+    }
+
+    /**
+     * @brief store the already known power strips, so the trace can be replayed without the
+     *        enumeration that discovered them.
+     */
+    const auto devices = database().get();
+    for (const auto &device : *devices)
+    {
+        if (device != nullptr)
+        {
+            m_io_trace.record_device(*device);
+        }
+    }
+
+    return true;
+}
+
+auto sokketter_core::stop_io_trace() -> void
+{
+    m_io_trace.stop();
+}
+
 auto sokketter_core::is_new_release_available(std::string &latest_version) -> bool
 {
+    start_logger();
+
     latest_version.clear();
     const auto current_version = sokketter::version().to_string();
+
+    std::string etag;
+    if (request_latest_release(etag, latest_version) != release_request_result::UPDATED)
+    {
+        return false;
+    }
+
+    return is_newer_version(current_version, latest_version);
+}
+
+auto sokketter_core::request_latest_release(std::string &etag, std::string &latest_version)
+    -> release_request_result
+{
     const std::string url = RELEASE_API_LINK;
 
     CURL *curl = curl_easy_init();
     if (curl == nullptr)
     {
         SPDLOG_LOGGER_WARN(SOKKETTER_LOGGER, "Failed to initialize curl for update check.");
-        return false;
+        return release_request_result::FAILED;
     }
 
     curl_string_buffer response = {};
     struct curl_slist *headers = curl_slist_append(nullptr, "Accept: application/vnd.github+json");
+    if (!etag.empty())
+    {
+        headers = curl_slist_append(headers, ("If-None-Match: " + etag).c_str());
+    }
+
+    std::string response_etag;
+
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_USERAGENT, "sokketter");
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
@@ -466,29 +1253,56 @@ auto sokketter_core::is_new_release_available(std::string &latest_version) -> bo
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_response_data);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, read_etag_header);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response_etag);
+
+    /**
+     * @attention the progress callback lets deinitialize() abort a slow request instead of
+     * blocking the process exit until the timeout expires.
+     */
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, update_check_progress);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &m_update_check_abort);
 
     const auto result = curl_easy_perform(curl);
+
+    long response_code = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+
     curl_easy_cleanup(curl);
     curl_slist_free_all(headers);
 
+    if (result == CURLE_ABORTED_BY_CALLBACK)
+    {
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Update check was aborted.");
+        return release_request_result::FAILED;
+    }
+
     if (result != CURLE_OK)
     {
         SPDLOG_LOGGER_WARN(
             SOKKETTER_LOGGER, "Failed checking GitHub releases: {}.", curl_easy_strerror(result));
-        return false;
+        return release_request_result::FAILED;
+    }
+
+    if (response_code == 304)
+    {
+        SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Latest release has not changed since last check.");
+        return release_request_result::NOT_MODIFIED;
     }
 
     if (response.data.empty())
     {
-        return false;
+        return release_request_result::FAILED;
     }
 
     try
     {
         const auto json_response = nlohmann::json::parse(response.data);
-        if (!json_response.contains("tag_name") || !json_response["tag_name"].is_string())
+        if (!json_response.contains("tag_name") || !json_response["tag_name"].is_string() ||
+            json_response["tag_name"].get<std::string>().empty())
         {
-            return false;
+            return release_request_result::FAILED;
         }
 
         latest_version = json_response["tag_name"].get<std::string>();
@@ -497,37 +1311,42 @@ auto sokketter_core::is_new_release_available(std::string &latest_version) -> bo
     {
         SPDLOG_LOGGER_WARN(
             SOKKETTER_LOGGER, "Failed parsing GitHub release response: {}.", exception.what());
-        return false;
+        return release_request_result::FAILED;
     }
 
-    if (latest_version.empty())
-    {
-        return false;
-    }
+    etag = response_etag;
 
-    return is_newer_version(current_version, latest_version);
+    return release_request_result::UPDATED;
 }
 
 auto sokketter_core::initialize_logger() -> void
 {
+    const auto settings = this->settings();
+
     std::vector<spdlog::sink_ptr> new_sinks;
 
-    if (m_settings.logging_callback != nullptr)
+    /**
+     * @attention the previous dispatcher keeps delivering until the new logger is published.
+     */
+    auto retired_async_sink = std::move(m_async_sink);
+
+    if (settings.logging_callback != nullptr || settings.logging_view_callback != nullptr)
     {
         /**
          * @brief initialize only callback functionality.
          */
-        auto callback_sink = std::make_shared<spdlog::sinks::callback_sink_mt>(
-            [](const spdlog::details::log_msg &msg) {
-                const auto &settings = sokketter_core::instance().settings();
-                if (settings.logging_callback != nullptr)
-                {
-                    settings.logging_callback(sokketter::callback_response_structure{
-                        sokketter::logging_level(msg.level), msg.source.filename, msg.source.line,
-                        msg.source.funcname, std::string(msg.payload.data(), msg.payload.size())});
-                }
-            });
-        new_sinks.push_back(callback_sink);
+        logging_callbacks callbacks{settings.logging_callback, settings.logging_view_callback};
+
+        if (settings.logging_mode == sokketter::logging_mode::ASYNCHRONOUS)
+        {
+            m_async_sink = std::make_shared<async_logging_callback_sink>(
+                std::move(callbacks), settings.logging_queue_size);
+            new_sinks.push_back(m_async_sink);
+        }
+        else
+        {
+            new_sinks.push_back(std::make_shared<logging_callback_sink>(std::move(callbacks)));
+        }
     }
     else
     {
@@ -571,16 +1390,20 @@ auto sokketter_core::initialize_logger() -> void
         spdlog::register_logger(m_logger);
     }
 
-    SOKKETTER_LOGGER->set_level(spdlog::level::level_enum(m_settings.logging_level));
-    SOKKETTER_LOGGER->set_pattern(m_settings.logging_pattern);
+    sokketter_logger::publish(m_logger);
 
-    kommpot::settings_structure settings;
+    if (retired_async_sink != nullptr)
+    {
+        retired_async_sink->stop();
+    }
 
-    settings.logging_level = kommpot::logging_level(m_settings.logging_level);
-    settings.logging_callback =
-        std::bind(&sokketter_core::logging_callback, this, std::placeholders::_1);
+    SOKKETTER_LOGGER->set_level(spdlog::level::level_enum(settings.logging_level));
+    SOKKETTER_LOGGER->set_pattern(settings.logging_pattern);
 
-    kommpot::set_settings(settings);
+    if (m_is_kommpot_initialized.load())
+    {
+        apply_kommpot_settings();
+    }
 
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "A new logging session is started.");
 }
@@ -592,13 +1415,36 @@ auto sokketter_core::deinitialize_logger() -> void
         return;
     }
 
-    kommpot::settings_structure settings;
-    settings.logging_level = kommpot::logging_level::OFF;
-    kommpot::set_settings(settings);
+    if (m_is_kommpot_initialized.load())
+    {
+        kommpot::settings_structure settings;
+        settings.logging_level = kommpot::logging_level::OFF;
+        kommpot::set_settings(settings);
+    }
 
     SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "The logging session is finished.");
     SOKKETTER_LOGGER->flush();
+    sokketter_logger::publish(nullptr);
     spdlog::drop(LOGGER_NAME);
+
+    if (m_async_sink != nullptr)
+    {
+        m_async_sink->stop();
+        m_async_sink = nullptr;
+    }
+}
+
+auto sokketter_core::apply_kommpot_settings() -> void
+{
+    const auto logging_level = this->settings().logging_level;
+
+    kommpot::settings_structure settings;
+
+    settings.logging_level = kommpot::logging_level(logging_level);
+    settings.logging_callback =
+        std::bind(&sokketter_core::logging_callback, this, std::placeholders::_1);
+
+    kommpot::set_settings(settings);
 }
 
 auto sokketter_core::logging_callback(const kommpot::callback_response_structure &response) -> void
@@ -615,80 +1461,44 @@ auto sokketter_core::logging_callback(const kommpot::callback_response_structure
 auto sokketter_core::new_devices_received(
     std::vector<std::shared_ptr<kommpot::device_communication>> communications) -> void
 {
-    auto &database = sokketter_core::instance().database().get();
-
-    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Connected devices: {}.", communications.size());
+    const auto database = merge_communications(communications);
 
-    for (auto &communication : communications)
+    sokketter::device_callback device_cb = nullptr;
     {
-        auto device = power_strip_factory::create(communication);
-        if (!device)
-        {
-            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER, "Failed creating the device!");
-            continue;
-        }
-
-        auto baseDevice = dynamic_cast<sokketter::power_strip *>(device.get());
-        if (baseDevice == nullptr)
-        {
-            SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
-                "{}: failed casting the device to power_strip_base!", device->to_string());
-            continue;
-        }
-
-        /**
-         * @brief look for saved configuration of this device.
-         */
-        auto it = std::find_if(database.begin(), database.end(),
-            [&](const std::shared_ptr<sokketter::power_strip> &item) {
-                return item && item->configuration().id == device->configuration().id;
-            });
-
-        if (it != database.end())
-        {
-            auto baseIt = dynamic_cast<power_strip_base *>(it->get());
-            if (baseIt == nullptr)
-            {
-                SPDLOG_LOGGER_ERROR(SOKKETTER_LOGGER,
-                    "{}: failed casting the device to power_strip_base!", device->to_string());
-                continue;
-            }
-
-            baseIt->initialize(communication);
-
-            SPDLOG_LOGGER_DEBUG(
-                SOKKETTER_LOGGER, "{}: device was successfully created!", device->to_string());
-        }
-        else
-        {
-            /**
-             * @brief append basic device configuration if it is a first time.
-             */
-            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
-                "{}: new device was successfully created and added to database!",
-                device->to_string());
+        const std::lock_guard<std::mutex> lock(m_callbacks_mutex);
+        device_cb = m_device_cb;
+    }
 
-            database.push_back(device);
+    if (device_cb != nullptr)
+    {
+        auto devices = *database;
+        device_cb(devices);
+    }
+}
 
-            sokketter_core::instance().database().save();
-        }
+auto sokketter_core::new_status_received(kommpot::enumeration_status status) -> void
+{
+    if (status == kommpot::enumeration_status::COMPLETED && m_pending_enumerations.load() > 0 &&
+        m_pending_enumerations.fetch_sub(1) > 1)
+    {
+        return;
     }
 
-    /**
-     * Sort the database by device name.
-     */
-    std::sort(database.begin(), database.end(),
-        [](const std::shared_ptr<sokketter::power_strip> &a,
-            const std::shared_ptr<sokketter::power_strip> &b) {
-            return a->configuration().name < b->configuration().name;
-        });
+    if (status == kommpot::enumeration_status::COMPLETED)
+    {
+        m_serial_cache.end_scan();
 
-    SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER, "Created devices: {}.", database.size());
+        warm_up_ethernet_devices(*database().get());
+    }
 
-    m_device_cb(database);
-}
+    sokketter::status_callback status_cb = nullptr;
+    {
+        const std::lock_guard<std::mutex> lock(m_callbacks_mutex);
+        status_cb = m_status_cb;
+    }
 
-auto sokketter_core::new_status_received(kommpot::enumeration_status status) -> void
-{
-    m_status_cb(static_cast<sokketter::enumeration_status>(status));
+    if (status_cb != nullptr)
+    {
+        status_cb(static_cast<sokketter::enumeration_status>(status));
+    }
 }
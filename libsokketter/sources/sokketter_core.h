@@ -4,17 +4,26 @@
 #pragma once
 
 #include <database_storage.h>
+#include <io_thread_pool.h>
+#include <io_trace.h>
+#include <lan_discovery.h>
 #include <libsokketter.h>
+#include <logging_callback_sink.h>
+#include <sokketter_logger.h>
 #include <spdlog/logger.h>
 #include <third-party/kommpot/libkommpot/include/libkommpot.h>
 #include <update_check_storage.h>
+#include <usb_serial_cache.h>
 
 #include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
 #include <mutex>
+#include <set>
 #include <thread>
 
 constexpr auto LOGGER_NAME = "sokketter";
-#define SOKKETTER_LOGGER spdlog::get(LOGGER_NAME)
 
 class sokketter_core
 {
@@ -46,20 +55,76 @@ public:
 
     auto device(const std::string &serial_number) -> std::shared_ptr<sokketter::power_strip>;
 
+    auto add_ethernet_device(const std::string &ip, const std::string &mac,
+        const std::string &password) -> std::shared_ptr<sokketter::power_strip>;
+
     auto release_link() -> std::string;
     auto is_new_release_available(std::string &latest_version) -> bool;
 
     auto check_for_update_async() -> void;
     auto last_update_check_status() -> sokketter::update_check_status;
 
+    auto set_executor(sokketter::executor executor) -> void;
+
+    /**
+     * @brief runs the task on the host-supplied executor or on the library I/O pool.
+     * @attention the task runs within the call options of the submitting thread.
+     */
+    auto execute(std::function<void()> task) -> void;
+
+    /**
+     * @brief runs the task like execute(), but only after the tasks submitted before it for the
+     * same power strip completed.
+     * @attention at most one task of a power strip is handed to the executor at a time, so a slow
+     * power strip occupies a single worker while the other power strips keep being served.
+     */
+    auto execute_serialized(const std::string &device_id, std::function<void()> task) -> void;
+
+    auto is_device_io_aborted() const -> bool;
+
+    auto io_trace() -> io_trace_recorder &;
+
+    auto serial_cache() -> usb_serial_cache &;
+
+    auto socket_state_cache_mode() -> sokketter::socket_state_cache_mode;
+
+    /**
+     * @brief gets the time a socket state stays fresh, taking the override of the power strip
+     * into account.
+     */
+    auto socket_state_cache_ttl(const std::string &device_id) -> std::chrono::milliseconds;
+
+    auto usb_retry_policy() -> sokketter::retry_policy;
+    auto ethernet_retry_policy() -> sokketter::retry_policy;
+    auto is_ethernet_status_hedging_enabled() -> bool;
+
+    auto start_io_trace(const std::filesystem::path &path) -> bool;
+    auto stop_io_trace() -> void;
+
 private:
     inline static constexpr auto RELEASE_LINK =
         "https://github.com/morwy/sokketter/releases/latest";
     inline static constexpr auto RELEASE_API_LINK =
         "https://api.github.com/repos/morwy/sokketter/releases/latest";
 
+    /**
+     * @brief guards m_settings, background tasks work on a copy taken with settings().
+     */
+    mutable std::mutex m_settings_mutex;
     sokketter::settings_structure m_settings;
     std::shared_ptr<spdlog::logger> m_logger = nullptr;
+    std::shared_ptr<async_logging_callback_sink> m_async_sink = nullptr;
+    /**
+     * @brief guards the lazy start of the logger, see start_logger().
+     */
+    std::mutex m_logger_mutex;
+    std::atomic_bool m_is_logger_started = false;
+    /**
+     * @brief guards the lazy initialization of kommpot and the device database.
+     */
+    std::mutex m_subsystems_mutex;
+    std::atomic_bool m_is_kommpot_initialized = false;
+    std::atomic_bool m_is_database_loaded = false;
     database_storage m_database;
 
     update_check_storage m_update_check_storage;
@@ -67,7 +132,58 @@ private:
     std::mutex m_update_check_thread_mutex;
     std::thread m_update_check_thread;
     std::atomic_bool m_update_check_running = false;
+    std::atomic_bool m_update_check_abort = false;
+
+    inline static constexpr size_t IO_THREAD_COUNT = 4;
+
+    io_thread_pool m_io_pool{IO_THREAD_COUNT};
+    std::mutex m_executor_mutex;
+    sokketter::executor m_executor = nullptr;
+
+    /**
+     * @brief tasks of a power strip waiting for the one handed to the executor.
+     */
+    struct device_strand
+    {
+        std::deque<std::function<void()>> tasks;
+        bool is_running = false;
+    };
+
+    std::mutex m_strands_mutex;
+    std::map<std::string, device_strand> m_strands;
+
+    /**
+     * @brief runs the oldest task of the power strip and hands the next one to the executor.
+     */
+    auto run_next_serialized(const std::string &device_id) -> void;
+
+    io_trace_recorder m_io_trace;
+
+    usb_serial_cache m_serial_cache;
 
+    /**
+     * @brief copies of the settings read by the drivers on every transfer, so they do not copy
+     * the whole settings structure each time.
+     */
+    std::mutex m_device_settings_mutex;
+    sokketter::socket_state_cache_mode m_socket_state_cache_mode =
+        sokketter::socket_state_cache_mode::TIME_TO_LIVE;
+    uint32_t m_socket_state_cache_ttl_msec = 1000;
+    std::map<std::string, uint32_t> m_socket_state_cache_ttl_msec_by_device;
+    sokketter::retry_policy m_usb_retry_policy;
+    sokketter::retry_policy m_ethernet_retry_policy;
+    bool m_is_ethernet_status_hedging_enabled = false;
+
+    std::atomic_bool m_discovery_abort = false;
+
+    /**
+     * @brief set while deinitializing, so running device calls stop their I/O.
+     */
+    std::atomic_bool m_device_io_abort = false;
+
+    std::atomic_size_t m_pending_enumerations = 0;
+
+    std::mutex m_callbacks_mutex;
     sokketter::device_callback m_device_cb = nullptr;
     sokketter::status_callback m_status_cb = nullptr;
 
@@ -77,20 +193,108 @@ private:
     auto initialize_logger() -> void;
     auto deinitialize_logger() -> void;
 
+    /**
+     * @brief starts the logger on the first call that does actual work, so commands that never
+     * touch a power strip do not open the console and syslog sinks.
+     */
+    auto start_logger() -> void;
+
+    /**
+     * @brief initializes kommpot on the first enumeration.
+     * @return true if kommpot is ready, false otherwise.
+     */
+    auto initialize_kommpot() -> bool;
+
+    /**
+     * @brief builds the communications of the power strips added by their address.
+     */
+    auto connect_registered_devices() -> void;
+    auto apply_kommpot_settings() -> void;
+
     struct curl_string_buffer
     {
         std::string data;
     };
 
+    /**
+     * @brief the enum specifying outcomes of a conditional release request.
+     */
+    enum class release_request_result
+    {
+        FAILED,
+        NOT_MODIFIED,
+        UPDATED
+    };
+
     static auto write_response_data(char *ptr, size_t size, size_t nmemb, void *userdata) -> size_t;
+    static auto read_etag_header(char *buffer, size_t size, size_t nitems, void *userdata)
+        -> size_t;
     static auto normalize_version_string(std::string version) -> std::string;
     static auto parse_version_parts(const std::string &version) -> std::vector<uint32_t>;
 
     auto is_newer_version(const std::string &current_version, const std::string &candidate_version)
         -> bool;
 
+    /**
+     * @brief requests the latest release from GitHub.
+     * @param etag sent as If-None-Match when not empty, replaced by the ETag of the response.
+     * @param latest_version replaced by the release tag when the release was fetched.
+     */
+    auto request_latest_release(std::string &etag, std::string &latest_version)
+        -> release_request_result;
+
+    auto is_ethernet_discovery_enabled(const sokketter::device_filter &filter) const -> bool;
+
+    /**
+     * @brief checks that the library sweeps subnets for missing Ethernet power strips, which
+     * replaces the Ethernet scan of kommpot.
+     * @attention without subnets, kommpot keeps scanning for the power strips the neighbour probe
+     * did not find.
+     */
+    auto is_ethernet_sweep_configured() const -> bool;
+
+    /**
+     * @brief reads the socket states of the Ethernet power strips in the background, see
+     * settings_structure::is_ethernet_warm_up_enabled.
+     */
+    auto warm_up_ethernet_devices(const database_storage::device_list &devices) -> void;
+    auto warm_up_ethernet_device(const std::shared_ptr<sokketter::power_strip> &device) -> void;
+
+    static auto remove_ethernet_identifications(
+        std::vector<kommpot::device_identification> &identifications) -> void;
+
+    /**
+     * @brief lists the last known addresses of power strips and the neighbours with their MAC
+     * prefix.
+     */
+    auto known_ethernet_candidates() -> std::vector<lan_candidate>;
+
+    /**
+     * @brief lists the hosts of the configured subnets that were not probed yet.
+     */
+    auto subnet_ethernet_candidates(const std::vector<std::string> &subnets,
+        const std::set<std::string> &probed_addresses)
+        -> std::vector<lan_candidate>;
+
+    /**
+     * @brief probes the known candidates and sweeps the subnets for the missing power strips,
+     * calling back with a communication for each power strip as soon as it answers.
+     */
+    auto discover_ethernet_devices(
+        const std::function<void(std::shared_ptr<kommpot::device_communication>)> &found_cb)
+        -> void;
+
     auto logging_callback(const kommpot::callback_response_structure &response) -> void;
 
+    /**
+     * @brief creates power strips for the enumerated communications and publishes the updated
+     * device list.
+     * @return published device list snapshot.
+     */
+    auto merge_communications(
+        const std::vector<std::shared_ptr<kommpot::device_communication>> &communications)
+        -> std::shared_ptr<const database_storage::device_list>;
+
     auto new_devices_received(
         std::vector<std::shared_ptr<kommpot::device_communication>> communications) -> void;
     auto new_status_received(kommpot::enumeration_status status) -> void;
@@ -0,0 +1,6 @@
+#include "sokketter_logger.h"
+
+auto sokketter_logger::publish(std::shared_ptr<spdlog::logger> logger) -> void
+{
+    std::atomic_store(&s_logger, std::move(logger));
+}
@@ -0,0 +1,70 @@
+#ifndef SOKKETTER_LOGGER_H
+#define SOKKETTER_LOGGER_H
+
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief process-wide handle of the library logger.
+ *
+ * Call sites read an atomically swapped shared_ptr instead of looking the logger up in the spdlog
+ * registry, which takes a lock on every log statement. The copy they hold keeps the logger alive
+ * while they log, even when another thread publishes a new one in the meantime.
+ */
+class sokketter_logger
+{
+public:
+    /**
+     * @brief gets the current library logger.
+     * @return logger or nullptr when logging is not initialized.
+     */
+    static auto get() noexcept -> std::shared_ptr<spdlog::logger>
+    {
+        return std::atomic_load(&s_logger);
+    }
+
+    /**
+     * @brief publishes a new library logger.
+     * @param logger new logger, nullptr disables library logging.
+     */
+    static auto publish(std::shared_ptr<spdlog::logger> logger) -> void;
+
+private:
+    inline static std::shared_ptr<spdlog::logger> s_logger = nullptr;
+};
+
+#define SOKKETTER_LOGGER sokketter_logger::get()
+
+/**
+ * @brief replaces the spdlog call macro so that all SPDLOG_LOGGER_* macros tolerate a missing
+ * logger and evaluate their arguments only when the level is enabled.
+ */
+#undef SPDLOG_LOGGER_CALL
+#ifndef SPDLOG_NO_SOURCE_LOC
+#    define SPDLOG_LOGGER_CALL(logger, level, ...)                                                 \
+        do                                                                                         \
+        {                                                                                          \
+            const auto &sokketter_logger_handle = (logger);                                        \
+            if (sokketter_logger_handle != nullptr && sokketter_logger_handle->should_log(level))  \
+            {                                                                                      \
+                sokketter_logger_handle->log(                                                      \
+                    spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, level, __VA_ARGS__);  \
+            }                                                                                      \
+        } while (false)
+#else
+#    define SPDLOG_LOGGER_CALL(logger, level, ...)                                                 \
+        do                                                                                         \
+        {                                                                                          \
+            const auto &sokketter_logger_handle = (logger);                                        \
+            if (sokketter_logger_handle != nullptr && sokketter_logger_handle->should_log(level))  \
+            {                                                                                      \
+                sokketter_logger_handle->log(spdlog::source_loc{}, level, __VA_ARGS__);            \
+            }                                                                                      \
+        } while (false)
+#endif
+
+#endif // SOKKETTER_LOGGER_H
@@ -0,0 +1,105 @@
+#include "transfer_policy.h"
+
+#include <call_context.h>
+#include <sokketter_core.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <thread>
+
+auto latency_tracker::record(const std::chrono::microseconds &latency) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_latencies.size() < WINDOW_SIZE)
+    {
+        m_latencies.push_back(latency);
+        return;
+    }
+
+    m_latencies[m_next] = latency;
+    m_next = (m_next + 1) % WINDOW_SIZE;
+}
+
+auto latency_tracker::percentile(const double &share, std::chrono::microseconds &latency) -> bool
+{
+    std::vector<std::chrono::microseconds> latencies;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_latencies.size() < MINIMUM_SAMPLES)
+        {
+            return false;
+        }
+
+        latencies = m_latencies;
+    }
+
+    const double clamped_share = std::clamp(share, 0.0, 1.0);
+    const auto position = latencies.begin() + static_cast<std::ptrdiff_t>(std::ceil(
+                                                   clamped_share * (latencies.size() - 1)));
+
+    std::nth_element(latencies.begin(), position, latencies.end());
+    latency = *position;
+
+    return true;
+}
+
+auto transfer_policy::backoff(const sokketter::retry_policy &policy, const uint32_t &attempt)
+    -> std::chrono::milliseconds
+{
+    double backoff_msec = policy.initial_backoff_msec *
+                          std::pow(std::max(policy.backoff_multiplier, 1.0), attempt - 1);
+    backoff_msec = std::min(backoff_msec, static_cast<double>(policy.max_backoff_msec));
+
+    /**
+     * @attention jitter spreads the retries of power strips that failed together, e.g. behind the
+     * same USB hub, so they do not hit it again at the same moment.
+     */
+    const double jitter = std::clamp(policy.jitter, 0.0, 1.0);
+    if (jitter > 0.0)
+    {
+        thread_local std::mt19937 generator{std::random_device{}()};
+        std::uniform_real_distribution<double> distribution(1.0 - jitter, 1.0 + jitter);
+        backoff_msec *= distribution(generator);
+    }
+
+    return std::chrono::milliseconds(static_cast<int64_t>(std::max(backoff_msec, 0.0)));
+}
+
+auto transfer_policy::retry(const sokketter::retry_policy &policy, const std::string &description,
+    const std::function<bool()> &attempt) -> bool
+{
+    const uint32_t max_attempts = std::max<uint32_t>(policy.max_attempts, 1);
+
+    for (uint32_t attempt_number = 1;; ++attempt_number)
+    {
+        if (call_context::is_expired())
+        {
+            SPDLOG_LOGGER_WARN(SOKKETTER_LOGGER,
+                "{}: call cancelled or past its deadline, skipping transfer attempt {}.",
+                description, attempt_number);
+            return false;
+        }
+
+        if (attempt())
+        {
+            return true;
+        }
+
+        if (attempt_number >= max_attempts)
+        {
+            return false;
+        }
+
+        const auto delay = call_context::remaining(backoff(policy, attempt_number));
+
+        SPDLOG_LOGGER_WARN(SOKKETTER_LOGGER,
+            "{}: transfer attempt {} of {} failed, retrying in {} ms.", description,
+            attempt_number, max_attempts, delay.count());
+
+        std::this_thread::sleep_for(delay);
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef TRANSFER_POLICY_H
+#define TRANSFER_POLICY_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief latencies of the recent successful exchanges with a single power strip.
+ */
+class latency_tracker
+{
+public:
+    auto record(const std::chrono::microseconds &latency) -> void;
+
+    /**
+     * @brief gets the latency below which the given share of the recent exchanges completed.
+     * @param share between 0 and 1, e.g. 0.95 for the 95th percentile.
+     * @return false while too few exchanges were recorded, true otherwise.
+     */
+    auto percentile(const double &share, std::chrono::microseconds &latency) -> bool;
+
+private:
+    /**
+     * @brief number of recent exchanges kept and the minimum needed for a percentile.
+     */
+    inline static constexpr size_t WINDOW_SIZE = 64;
+    inline static constexpr size_t MINIMUM_SAMPLES = 20;
+
+    std::mutex m_mutex;
+    std::vector<std::chrono::microseconds> m_latencies;
+    size_t m_next = 0;
+};
+
+/**
+ * @brief retrying of failed device transfers.
+ */
+namespace transfer_policy {
+    /**
+     * @brief runs the attempt until it succeeds or the policy runs out of attempts, waiting with
+     * exponential backoff and jitter in between.
+     * @attention no attempt is started once the call is cancelled or past its deadline, see
+     * sokketter::call_scope.
+     * @param description of the power strip, used for logging.
+     * @return true if any attempt succeeded, false otherwise.
+     */
+    auto retry(const sokketter::retry_policy &policy, const std::string &description,
+        const std::function<bool()> &attempt) -> bool;
+
+    /**
+     * @brief gets the time to wait before the attempt following the given one.
+     * @param attempt number of the failed attempt, starting at 1.
+     */
+    auto backoff(const sokketter::retry_policy &policy, const uint32_t &attempt)
+        -> std::chrono::milliseconds;
+} // namespace transfer_policy
+
+#endif // TRANSFER_POLICY_H
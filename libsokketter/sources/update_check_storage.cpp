@@ -59,6 +59,8 @@ auto parse_update_check_status(const nlohmann::json &j) -> update_check_storage:
 
     r.status.new_version = j.value("new_version", "");
     r.latest_version = j.value("latest_version", r.status.new_version);
+    r.attempted_at = j.value("attempted_at", int64_t(0));
+    r.etag = j.value("etag", "");
 
     return r;
 }
@@ -110,7 +112,8 @@ auto update_check_storage::save() const -> void
 
         nlohmann::json j = nlohmann::json{{"checked_at", m_result.status.checked_at},
             {"new_version", m_result.status.new_version},
-            {"latest_version", m_result.latest_version}};
+            {"latest_version", m_result.latest_version}, {"attempted_at", m_result.attempted_at},
+            {"etag", m_result.etag}};
         file << j.dump(4);
 
         if (!file.good())
@@ -5,6 +5,7 @@
 
 #include "../include/libsokketter.h"
 
+#include <cstdint>
 #include <filesystem>
 
 /**
@@ -17,6 +18,16 @@ public:
     {
         sokketter::update_check_status status;
         std::string latest_version;
+
+        /**
+         * @brief seconds since epoch of the latest check attempt, successful or not.
+         */
+        int64_t attempted_at = 0;
+
+        /**
+         * @brief ETag of the latest release response, sent back as If-None-Match.
+         */
+        std::string etag;
     };
 
     update_check_storage() = default;
@@ -0,0 +1,112 @@
+#include "usb_serial_cache.h"
+
+#include <sokketter_core.h>
+#include <spdlog/spdlog.h>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+auto usb_serial_cache::key(const kommpot::usb_device_identification &identification)
+    -> std::string
+{
+    const std::string attach_number = usb_serial_cache::attach_number(identification.port);
+    if (attach_number.empty())
+    {
+        return "";
+    }
+
+    std::ostringstream key;
+    key << identification.port << "#" << attach_number << "|" << std::hex << std::setw(4)
+        << std::setfill('0') << identification.vendor_id << ":" << std::setw(4)
+        << identification.product_id << "|" << identification.serial_number << "|"
+        << identification.name;
+
+    return key.str();
+}
+
+auto usb_serial_cache::attach_number(const std::string &port) -> std::string
+{
+    std::string number = "";
+
+#ifdef __linux__
+    if (port.empty() || port.find('/') != std::string::npos)
+    {
+        return number;
+    }
+
+    /**
+     * @brief the device number is assigned anew on every attach, even on the same port.
+     */
+    std::ifstream file("/sys/bus/usb/devices/" + port + "/devnum");
+    if (!file.is_open() || !(file >> number))
+    {
+        number.clear();
+    }
+#endif
+
+    return number;
+}
+
+auto usb_serial_cache::begin_scan() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_scan;
+}
+
+auto usb_serial_cache::end_scan() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        /**
+         * @attention a device unplugged during the scan may come back on the same port as a
+         * different device, so its serial number must be read again.
+         */
+        if (it->second.scan != m_scan)
+        {
+            SPDLOG_LOGGER_DEBUG(SOKKETTER_LOGGER,
+                "USB device '{}' was not seen in the last scan, forgetting its serial number.",
+                it->first);
+            it = m_entries.erase(it);
+            continue;
+        }
+
+        ++it;
+    }
+}
+
+auto usb_serial_cache::find(const std::string &key, std::string &serial_number) -> bool
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    it->second.scan = m_scan;
+    serial_number = it->second.serial_number;
+
+    return true;
+}
+
+auto usb_serial_cache::store(const std::string &key, const std::string &serial_number) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[key] = {serial_number, m_scan};
+}
+
+auto usb_serial_cache::invalidate(const std::string &key) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase(key);
+}
+
+auto usb_serial_cache::clear() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
@@ -0,0 +1,65 @@
+#ifndef USB_SERIAL_CACHE_H
+#define USB_SERIAL_CACHE_H
+
+#pragma once
+
+#include <third-party/kommpot/libkommpot/include/libkommpot.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief serial numbers of USB power strips read over control transfers, kept per USB topology
+ * entry so that re-enumerating unchanged devices needs no device I/O.
+ *
+ * An entry lives as long as its topology entry is seen in every scan. A device missing from a
+ * scan, or failing any transfer, has its entry dropped and the serial is read again next time.
+ */
+class usb_serial_cache
+{
+public:
+    /**
+     * @brief builds the cache key out of the port path, the descriptor data and the attach number
+     * of the device.
+     * @attention identical power strips swapped between two scans share the port path and the
+     * descriptor data, so only the number given by the system on attach tells them apart.
+     * @return empty if the attach number is not available, the serial number is not cached then.
+     */
+    static auto key(const kommpot::usb_device_identification &identification) -> std::string;
+
+    /**
+     * @brief starts a scan, entries not looked up or stored until end_scan() are evicted then.
+     */
+    auto begin_scan() -> void;
+    auto end_scan() -> void;
+
+    /**
+     * @brief looks up the serial number and marks the entry as seen in the current scan.
+     * @return true if the serial number is cached, false otherwise.
+     */
+    auto find(const std::string &key, std::string &serial_number) -> bool;
+    auto store(const std::string &key, const std::string &serial_number) -> void;
+    auto invalidate(const std::string &key) -> void;
+    auto clear() -> void;
+
+private:
+    struct entry
+    {
+        std::string serial_number = "";
+        uint64_t scan = 0;
+    };
+
+    std::mutex m_mutex;
+    std::map<std::string, entry> m_entries;
+    uint64_t m_scan = 0;
+
+    /**
+     * @brief reads the device number the system assigned when the device on the port was attached.
+     * @return empty if it is not available.
+     */
+    static auto attach_number(const std::string &port) -> std::string;
+};
+
+#endif // USB_SERIAL_CACHE_H
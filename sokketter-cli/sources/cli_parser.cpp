@@ -17,6 +17,113 @@ namespace {
 
         return argument;
     }
+
+    /**
+     * @brief parses a socket given as "DEVICE_ID/INDEX", the index starting from 1 like the
+     * physical markings.
+     */
+    auto parse_socket_reference(const std::string &argument, sokketter::socket_reference &reference)
+        -> bool
+    {
+        const auto separator = argument.rfind('/');
+        if (separator == std::string::npos || separator == 0)
+        {
+            return false;
+        }
+
+        try
+        {
+            size_t parsed_size = 0;
+            const auto index = std::stoul(argument.substr(separator + 1), &parsed_size);
+            if (index == 0 || parsed_size != argument.size() - separator - 1)
+            {
+                return false;
+            }
+
+            reference.device_id = argument.substr(0, separator);
+            reference.socket_index = index - 1;
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief parses a socket state given as "DEVICE_ID/INDEX=on" or "DEVICE_ID/INDEX=off".
+     */
+    auto parse_socket_state(const std::string &argument, sokketter::socket_reference &reference,
+        bool &is_powered_on) -> bool
+    {
+        const auto separator = argument.rfind('=');
+        if (separator == std::string::npos)
+        {
+            return false;
+        }
+
+        auto state = argument.substr(separator + 1);
+        std::transform(state.begin(), state.end(), state.begin(),
+            [](unsigned char character) { return static_cast<char>(std::tolower(character)); });
+
+        if (state != "on" && state != "off")
+        {
+            return false;
+        }
+
+        is_powered_on = state == "on";
+
+        return parse_socket_reference(argument.substr(0, separator), reference);
+    }
+
+    auto reconciliation_result_to_string(const sokketter::reconciliation_result &result)
+        -> std::string
+    {
+        switch (result)
+        {
+        case sokketter::reconciliation_result::UNCHANGED: {
+            return "unchanged";
+        }
+        case sokketter::reconciliation_result::SWITCHED: {
+            return "switched";
+        }
+        case sokketter::reconciliation_result::UNKNOWN_DEVICE: {
+            return "unknown device";
+        }
+        case sokketter::reconciliation_result::UNKNOWN_SOCKET: {
+            return "unknown socket";
+        }
+        default:
+        case sokketter::reconciliation_result::FAILED: {
+            return "failed";
+        }
+        }
+    }
+
+    /**
+     * @brief prints the outcome of every socket of a group or scene.
+     * @return EXIT_SUCCESS if all sockets reached their states, EXIT_FAILURE otherwise.
+     */
+    auto print_reconciliation(const std::vector<sokketter::socket_reconciliation> &report) -> int
+    {
+        int exit_code = EXIT_SUCCESS;
+
+        for (const auto &entry : report)
+        {
+            std::cout << "  " << entry.device_id << " socket " << entry.socket_index + 1 << ": "
+                      << (entry.is_powered_on ? "on" : "off") << ", "
+                      << reconciliation_result_to_string(entry.result) << "." << std::endl;
+
+            if (entry.result != sokketter::reconciliation_result::UNCHANGED &&
+                entry.result != sokketter::reconciliation_result::SWITCHED)
+            {
+                exit_code = EXIT_FAILURE;
+            }
+        }
+
+        return exit_code;
+    }
 } // namespace
 
 int cli_parser::parse_and_process(int argc, char *argv[])
@@ -62,6 +169,53 @@ int cli_parser::parse_and_process(int argc, char *argv[])
     auto subcommand_power_off = subcommand_power->add_subcommand("off");
     auto subcommand_power_toggle = subcommand_power->add_subcommand("toggle");
 
+    /**
+     * @brief adding an add-device subcommand.
+     */
+    auto subcommand_add_device = application.add_subcommand("add-device");
+    subcommand_add_device->ignore_underscore();
+
+    std::string device_ip = "";
+    auto option_device_ip = subcommand_add_device->add_option("--ip", device_ip);
+
+    std::string device_mac = "";
+    auto option_device_mac = subcommand_add_device->add_option("--mac", device_mac);
+
+    std::string device_password = "";
+    subcommand_add_device->add_option("--password,-p", device_password);
+
+    /**
+     * @brief adding group and scene subcommands.
+     */
+    auto subcommand_group = application.add_subcommand("group");
+    subcommand_group->ignore_underscore();
+
+    auto subcommand_group_list = subcommand_group->add_subcommand("list");
+    auto subcommand_group_save = subcommand_group->add_subcommand("save");
+    auto subcommand_group_remove = subcommand_group->add_subcommand("remove");
+    auto subcommand_group_on = subcommand_group->add_subcommand("on");
+    auto subcommand_group_off = subcommand_group->add_subcommand("off");
+
+    std::string group_name = "";
+    auto option_group_name = subcommand_group->add_option("--name", group_name);
+
+    std::vector<std::string> group_sockets;
+    auto option_group_sockets = subcommand_group->add_option("--sockets,-s", group_sockets);
+
+    auto subcommand_scene = application.add_subcommand("scene");
+    subcommand_scene->ignore_underscore();
+
+    auto subcommand_scene_list = subcommand_scene->add_subcommand("list");
+    auto subcommand_scene_save = subcommand_scene->add_subcommand("save");
+    auto subcommand_scene_remove = subcommand_scene->add_subcommand("remove");
+    auto subcommand_scene_apply = subcommand_scene->add_subcommand("apply");
+
+    std::string scene_name = "";
+    auto option_scene_name = subcommand_scene->add_option("--name", scene_name);
+
+    std::vector<std::string> scene_sockets;
+    auto option_scene_sockets = subcommand_scene->add_option("--sockets,-s", scene_sockets);
+
     subcommand_list->excludes(subcommand_power);
     subcommand_power->excludes(subcommand_list);
 
@@ -81,8 +235,15 @@ int cli_parser::parse_and_process(int argc, char *argv[])
     std::string device_serial = "";
     auto option_device_serial = device_group->add_option("--device-with-serial,-n", device_serial);
 
+    /**
+     * @brief adding a time limit for all power strip operations of the power subcommands.
+     */
+    uint32_t timeout_msec = 0;
+    auto option_timeout = subcommand_power->add_option("--timeout-msec", timeout_msec);
+
     option_device_index->ignore_underscore();
     option_device_serial->ignore_underscore();
+    option_timeout->ignore_underscore();
     option_device_index->excludes(option_device_serial);
     option_device_serial->excludes(option_device_index);
 
@@ -90,7 +251,10 @@ int cli_parser::parse_and_process(int argc, char *argv[])
      * @attention overwriting the default help to show the same text for all subcommands.
      */
     const auto commands = {subcommand_list, subcommand_power, subcommand_power_status,
-        subcommand_power_on, subcommand_power_off, subcommand_power_toggle};
+        subcommand_power_on, subcommand_power_off, subcommand_power_toggle, subcommand_add_device,
+        subcommand_group, subcommand_group_list, subcommand_group_save, subcommand_group_remove,
+        subcommand_group_on, subcommand_group_off, subcommand_scene, subcommand_scene_list,
+        subcommand_scene_save, subcommand_scene_remove, subcommand_scene_apply};
     for (const auto &command : commands)
     {
         command->set_help_flag();
@@ -249,6 +413,10 @@ int cli_parser::parse_and_process(int argc, char *argv[])
             return EXIT_FAILURE;
         }
 
+        sokketter::call_options options;
+        options.timeout_msec = timeout_msec;
+        const sokketter::call_scope scope(options);
+
         /**
          * @attention use all sockets if no indices were specified.
          */
@@ -332,6 +500,239 @@ int cli_parser::parse_and_process(int argc, char *argv[])
         return EXIT_SUCCESS;
     }
 
+    /** ************************************************************************
+     *
+     * @brief add-device processing section.
+     *
+     ** ***********************************************************************/
+    else if (subcommand_add_device->parsed())
+    {
+        if (option_device_ip->count() == 0 || option_device_mac->count() == 0)
+        {
+            std::cerr << "Both --ip and --mac options are required." << std::endl
+                      << "Run with --help for more information." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        const auto device = sokketter::add_ethernet_device(device_ip, device_mac, device_password);
+        if (device == nullptr)
+        {
+            std::cerr << "Failed adding the device at " << device_ip << " with MAC address "
+                      << device_mac << "." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << "Added device: " << device->to_string() << std::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    /** ************************************************************************
+     *
+     * @brief group processing section.
+     *
+     ** ***********************************************************************/
+    else if (subcommand_group->parsed())
+    {
+        if (!subcommand_group_list->parsed() && !subcommand_group_save->parsed() &&
+            !subcommand_group_remove->parsed() && !subcommand_group_on->parsed() &&
+            !subcommand_group_off->parsed())
+        {
+            std::cerr << "A group subcommand is required." << std::endl
+                      << "Run with --help for more information." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (subcommand_group_list->parsed())
+        {
+            const auto &groups = sokketter::groups();
+            if (groups.empty())
+            {
+                std::cerr << "No groups saved." << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            for (const auto &group : groups)
+            {
+                std::cout << group.name << ":";
+                for (const auto &socket : group.sockets)
+                {
+                    std::cout << " " << socket.device_id << "/" << socket.socket_index + 1;
+                }
+                std::cout << std::endl;
+            }
+
+            return EXIT_SUCCESS;
+        }
+
+        if (option_group_name->count() == 0 || group_name.empty())
+        {
+            std::cerr << "--name option is required." << std::endl
+                      << "Run with --help for more information." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (subcommand_group_save->parsed())
+        {
+            sokketter::socket_group group;
+            group.name = group_name;
+
+            for (const auto &argument : group_sockets)
+            {
+                sokketter::socket_reference reference;
+                if (!parse_socket_reference(argument, reference))
+                {
+                    std::cerr << "Socket '" << argument
+                              << "' is not in DEVICE_ID/INDEX format." << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                group.sockets.push_back(reference);
+            }
+
+            if (option_group_sockets->count() == 0 || group.sockets.empty())
+            {
+                std::cerr << "--sockets option is required." << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            sokketter::save_group(group);
+            std::cout << "Saved group '" << group_name << "'." << std::endl;
+
+            return EXIT_SUCCESS;
+        }
+
+        if (subcommand_group_remove->parsed())
+        {
+            if (!sokketter::forget_group(group_name))
+            {
+                std::cerr << "No group named '" << group_name << "' was found." << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            std::cout << "Removed group '" << group_name << "'." << std::endl;
+
+            return EXIT_SUCCESS;
+        }
+
+        const auto &report = sokketter::power_group(
+            sokketter::devices(), group_name, subcommand_group_on->parsed());
+        if (report.empty())
+        {
+            std::cerr << "No group named '" << group_name << "' was found." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << "Group '" << group_name << "':" << std::endl;
+
+        return print_reconciliation(report);
+    }
+
+    /** ************************************************************************
+     *
+     * @brief scene processing section.
+     *
+     ** ***********************************************************************/
+    else if (subcommand_scene->parsed())
+    {
+        if (!subcommand_scene_list->parsed() && !subcommand_scene_save->parsed() &&
+            !subcommand_scene_remove->parsed() && !subcommand_scene_apply->parsed())
+        {
+            std::cerr << "A scene subcommand is required." << std::endl
+                      << "Run with --help for more information." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (subcommand_scene_list->parsed())
+        {
+            const auto &scenes = sokketter::scenes();
+            if (scenes.empty())
+            {
+                std::cerr << "No scenes saved." << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            for (const auto &scene : scenes)
+            {
+                std::cout << scene.name << ":";
+                for (const auto &[device_id, device_states] : scene.states)
+                {
+                    for (const auto &[socket_index, is_powered_on] : device_states)
+                    {
+                        std::cout << " " << device_id << "/" << socket_index + 1 << "="
+                                  << (is_powered_on ? "on" : "off");
+                    }
+                }
+                std::cout << std::endl;
+            }
+
+            return EXIT_SUCCESS;
+        }
+
+        if (option_scene_name->count() == 0 || scene_name.empty())
+        {
+            std::cerr << "--name option is required." << std::endl
+                      << "Run with --help for more information." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        if (subcommand_scene_save->parsed())
+        {
+            sokketter::socket_scene scene;
+            scene.name = scene_name;
+
+            for (const auto &argument : scene_sockets)
+            {
+                sokketter::socket_reference reference;
+                bool is_powered_on = false;
+                if (!parse_socket_state(argument, reference, is_powered_on))
+                {
+                    std::cerr << "Socket '" << argument
+                              << "' is not in DEVICE_ID/INDEX=on or DEVICE_ID/INDEX=off format."
+                              << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+                scene.states[reference.device_id][reference.socket_index] = is_powered_on;
+            }
+
+            if (option_scene_sockets->count() == 0 || scene.states.empty())
+            {
+                std::cerr << "--sockets option is required." << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            sokketter::save_scene(scene);
+            std::cout << "Saved scene '" << scene_name << "'." << std::endl;
+
+            return EXIT_SUCCESS;
+        }
+
+        if (subcommand_scene_remove->parsed())
+        {
+            if (!sokketter::forget_scene(scene_name))
+            {
+                std::cerr << "No scene named '" << scene_name << "' was found." << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            std::cout << "Removed scene '" << scene_name << "'." << std::endl;
+
+            return EXIT_SUCCESS;
+        }
+
+        const auto &report = sokketter::apply_scene(sokketter::devices(), scene_name);
+        if (report.empty())
+        {
+            std::cerr << "No scene named '" << scene_name << "' was found." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::cout << "Scene '" << scene_name << "':" << std::endl;
+
+        return print_reconciliation(report);
+    }
+
     // LCOV_EXCL_START
     return EXIT_FAILURE;
     // LCOV_EXCL_STOP
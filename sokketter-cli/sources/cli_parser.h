@@ -59,12 +59,71 @@ public:
                 "Indices start "
                 "from 1 to be in accordance with physical markings\n\t\t\t\t\ton the device."
              << std::endl;
+        help << "    --timeout-msec UINT\t\t\tStates the time limit in milliseconds of each power "
+                "strip operation. 0 means\n\t\t\t\t\tthat only the transport timeouts apply. "
+                "Default: 0."
+             << std::endl;
+        help << std::endl;
+
+        help << "  add-device\tAdds an Ethernet power strip by its address, so it is used "
+                "without discovery."
+             << std::endl;
+        help << std::endl;
+
+        help << "  Options:" << std::endl;
+        help << "    --ip TEXT\t\t\t\tStates the IPv4 address of the power strip." << std::endl;
+        help << "    --mac TEXT\t\t\t\tStates the MAC address of the power strip." << std::endl;
+        help << "    -p,--password TEXT\t\t\tStates the password of the power strip." << std::endl;
+        help << std::endl;
+
+        help << "  group\t\tContains actions related to named groups of sockets spanning power "
+                "strips."
+             << std::endl;
+        help << std::endl;
+
+        help << "  Subcommands:" << std::endl;
+        help << "    list\t\tLists saved groups." << std::endl;
+        help << "    save\t\tSaves the group, replacing the group with the same name." << std::endl;
+        help << "    remove\tRemoves the group." << std::endl;
+        help << "    on\t\tTurns power on all sockets of the group." << std::endl;
+        help << "    off\t\tTurns power off all sockets of the group." << std::endl;
+        help << std::endl;
+
+        help << "  Options:" << std::endl;
+        help << "    --name TEXT\t\t\tStates the name of the group." << std::endl;
+        help << "    -s,--sockets TEXT ...\t\tStates the sockets of the group as DEVICE_ID/INDEX. "
+                "Indices start from 1."
+             << std::endl;
+        help << std::endl;
+
+        help << "  scene\t\tContains actions related to named socket states spanning power "
+                "strips."
+             << std::endl;
+        help << std::endl;
+
+        help << "  Subcommands:" << std::endl;
+        help << "    list\t\tLists saved scenes." << std::endl;
+        help << "    save\t\tSaves the scene, replacing the scene with the same name." << std::endl;
+        help << "    remove\tRemoves the scene." << std::endl;
+        help << "    apply\tBrings all sockets of the scene into their states." << std::endl;
+        help << std::endl;
+
+        help << "  Options:" << std::endl;
+        help << "    --name TEXT\t\t\tStates the name of the scene." << std::endl;
+        help << "    -s,--sockets TEXT ...\t\tStates the socket states of the scene as "
+                "DEVICE_ID/INDEX=on or DEVICE_ID/INDEX=off."
+             << std::endl;
         help << std::endl;
 
         help << "Examples:" << std::endl;
         help << "  sokketter-cli list" << std::endl;
         help << "  sokketter-cli power on --sockets 1 --device-at-index 0" << std::endl;
         help << "  sokketter-cli power status --device-with-serial 01:02:03:04:05" << std::endl;
+        help << "  sokketter-cli add-device --ip 192.168.0.10 --mac 88:B6:27:01:02:03" << std::endl;
+        help << "  sokketter-cli group save --name bench-3 --sockets 01:02:03:04:05/1 "
+                "88:B6:27:01:02:03/2"
+             << std::endl;
+        help << "  sokketter-cli group on --name bench-3" << std::endl;
         help << std::endl;
 
         return help.str();
@@ -0,0 +1,32 @@
+#ifndef SOKKETTER_CLI_TESTS_SETTINGS_TEST_H
+#define SOKKETTER_CLI_TESTS_SETTINGS_TEST_H
+
+#pragma once
+
+#include "libsokketter.h"
+
+#include <gtest/gtest.h>
+
+namespace test_settings {
+    /**
+     * @brief base of the fixtures changing the library settings, which are restored after every
+     * test, also when one of its assertions fails.
+     */
+    class settings_test : public testing::Test
+    {
+    protected:
+        auto SetUp() -> void override
+        {
+            m_previous_settings = sokketter::settings();
+        }
+
+        auto TearDown() -> void override
+        {
+            sokketter::set_settings(m_previous_settings);
+        }
+
+        sokketter::settings_structure m_previous_settings;
+    };
+} // namespace test_settings
+
+#endif // SOKKETTER_CLI_TESTS_SETTINGS_TEST_H
@@ -0,0 +1,139 @@
+#include "libsokketter.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace testing;
+
+namespace {
+    constexpr auto ASYNC_TIMEOUT = std::chrono::seconds(10);
+
+    auto set_test_device_number(const char *value) -> void
+    {
+#ifdef _WIN32
+        _putenv_s("LIBSOKKETTER_TEST_DEVICE_NUMBER", value);
+#else
+        setenv("LIBSOKKETTER_TEST_DEVICE_NUMBER", value, 1);
+#endif
+    }
+
+    auto unset_test_device_number() -> void
+    {
+#ifdef _WIN32
+        _putenv_s("LIBSOKKETTER_TEST_DEVICE_NUMBER", "");
+#else
+        unsetenv("LIBSOKKETTER_TEST_DEVICE_NUMBER");
+#endif
+    }
+
+    template <typename result_type>
+    auto wait_for(std::future<result_type> &future) -> result_type
+    {
+        EXPECT_EQ(future.wait_for(ASYNC_TIMEOUT), std::future_status::ready);
+        return future.get();
+    }
+} // namespace
+
+TEST(async_api_tests, power_and_status_round_trip)
+{
+    set_test_device_number("2");
+
+    auto device = sokketter::device(0);
+    ASSERT_NE(device, nullptr);
+
+    auto power_on = sokketter::power_async(device, 1, true);
+    EXPECT_TRUE(wait_for(power_on));
+
+    auto status = sokketter::status_async(device, 1);
+    EXPECT_TRUE(wait_for(status));
+
+    auto power_off = sokketter::power_async(device, 1, false);
+    EXPECT_TRUE(wait_for(power_off));
+
+    status = sokketter::status_async(device, 1);
+    EXPECT_FALSE(wait_for(status));
+
+    unset_test_device_number();
+}
+
+TEST(async_api_tests, bulk_operations)
+{
+    set_test_device_number("2");
+
+    auto device = sokketter::device(1);
+    ASSERT_NE(device, nullptr);
+
+    auto power_all = sokketter::power_all_async(device, true);
+    EXPECT_TRUE(wait_for(power_all));
+
+    auto states = sokketter::status_all_async(device);
+    const auto &initial_states = wait_for(states);
+    EXPECT_FALSE(initial_states.empty());
+    EXPECT_THAT(initial_states, Each(true));
+
+    power_all = sokketter::power_all_async(device, false);
+    EXPECT_TRUE(wait_for(power_all));
+
+    states = sokketter::status_all_async(device);
+    const auto &final_states = wait_for(states);
+    EXPECT_EQ(final_states.size(), initial_states.size());
+    EXPECT_THAT(final_states, Each(false));
+
+    unset_test_device_number();
+}
+
+TEST(async_api_tests, invalid_requests_fail)
+{
+    set_test_device_number("1");
+
+    auto device = sokketter::device(0);
+    ASSERT_NE(device, nullptr);
+
+    auto out_of_range = sokketter::power_async(device, 100, true);
+    EXPECT_FALSE(wait_for(out_of_range));
+
+    auto no_device = sokketter::power_async(nullptr, 0, true);
+    EXPECT_FALSE(wait_for(no_device));
+
+    auto no_device_states = sokketter::status_all_async(nullptr);
+    EXPECT_TRUE(wait_for(no_device_states).empty());
+
+    unset_test_device_number();
+}
+
+TEST(async_api_tests, custom_executor_and_completion_callback)
+{
+    set_test_device_number("1");
+
+    auto device = sokketter::device(0);
+    ASSERT_NE(device, nullptr);
+
+    std::atomic_size_t executed_tasks = 0;
+    sokketter::set_executor([&executed_tasks](std::function<void()> task) {
+        ++executed_tasks;
+        task();
+    });
+
+    std::promise<bool> completion;
+    sokketter::power_async(device, 0, true,
+        [&completion](bool is_successful) { completion.set_value(is_successful); });
+
+    auto completion_future = completion.get_future();
+    EXPECT_TRUE(wait_for(completion_future));
+    EXPECT_EQ(executed_tasks, 1);
+
+    sokketter::set_executor(nullptr);
+
+    auto status = sokketter::status_async(device, 0);
+    EXPECT_TRUE(wait_for(status));
+    EXPECT_EQ(executed_tasks, 1);
+
+    auto power_off = sokketter::power_async(device, 0, false);
+    EXPECT_TRUE(wait_for(power_off));
+
+    unset_test_device_number();
+}
@@ -0,0 +1,74 @@
+#include "libsokketter.h"
+#include "settings_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace testing;
+
+namespace {
+    constexpr auto DISCOVERY_TIMEOUT = std::chrono::seconds(10);
+
+    /**
+     * @brief limits the Ethernet discovery to the loopback host, which never answers as a power
+     * strip.
+     */
+    class ethernet_discovery_test : public test_settings::settings_test
+    {
+    protected:
+        auto SetUp() -> void override
+        {
+            settings_test::SetUp();
+
+            auto settings = m_previous_settings;
+            settings.ethernet_discovery_subnets = {"127.0.0.1/32", "not-a-subnet", "10.0.0.0/8"};
+            settings.ethernet_discovery_concurrency = 4;
+            settings.ethernet_discovery_timeout_msec = 200;
+            sokketter::set_settings(settings);
+        }
+    };
+} // namespace
+
+TEST_F(ethernet_discovery_test, blocking_discovery_keeps_known_devices)
+{
+    const auto known_count = sokketter::devices().size();
+
+    sokketter::device_filter filter;
+    filter.included_types = sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto &devices = sokketter::devices(filter);
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, DISCOVERY_TIMEOUT);
+    EXPECT_EQ(devices.size(), known_count);
+}
+
+TEST_F(ethernet_discovery_test, asynchronous_discovery_completes_once)
+{
+    std::atomic_size_t completed_count = 0;
+    std::promise<void> completed;
+
+    sokketter::devices(
+        {}, [](std::vector<std::shared_ptr<sokketter::power_strip>> &) {},
+        [&](sokketter::enumeration_status status) {
+            if (status == sokketter::enumeration_status::COMPLETED &&
+                completed_count.fetch_add(1) == 0)
+            {
+                completed.set_value();
+            }
+        });
+
+    ASSERT_EQ(completed.get_future().wait_for(DISCOVERY_TIMEOUT), std::future_status::ready);
+
+    /**
+     * @attention deinitialize() drains the discovery task, so a second completion would be seen.
+     */
+    ASSERT_TRUE(sokketter::deinitialize());
+    ASSERT_TRUE(sokketter::initialize());
+
+    EXPECT_EQ(completed_count.load(), 1);
+}
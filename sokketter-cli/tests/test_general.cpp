@@ -34,6 +34,12 @@ namespace {
     auto default_update_check_cache_path() -> std::filesystem::path
     { return std::filesystem::temp_directory_path() / "sokketter-cli-tests-update-check.json"; }
 
+    /**
+     * @brief devices added by the tests must not end up in the real, per-machine database.
+     */
+    auto default_database_path() -> std::filesystem::path
+    { return std::filesystem::temp_directory_path() / "sokketter-cli-tests-devices.json"; }
+
     class cli_test_environment final : public testing::Environment
     {
     public:
@@ -44,6 +50,10 @@ namespace {
             set_env("LIBSOKKETTER_TEST_UPDATE_CHECK_PATH", cache_path.string().c_str());
             set_env("LIBSOKKETTER_TEST_SKIP_UPDATE_CHECK", "1");
 
+            const auto &database_path = default_database_path();
+            std::filesystem::remove(database_path);
+            set_env("LIBSOKKETTER_TEST_DATABASE_PATH", database_path.string().c_str());
+
             ASSERT_TRUE(sokketter::initialize());
         }
 
@@ -54,6 +64,9 @@ namespace {
             unset_env("LIBSOKKETTER_TEST_UPDATE_CHECK_PATH");
             unset_env("LIBSOKKETTER_TEST_SKIP_UPDATE_CHECK");
             std::filesystem::remove(default_update_check_cache_path());
+
+            unset_env("LIBSOKKETTER_TEST_DATABASE_PATH");
+            std::filesystem::remove(default_database_path());
         }
     };
 
@@ -0,0 +1,129 @@
+#include "libsokketter.h"
+#include "trace_writer.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace testing;
+using namespace test_trace;
+
+namespace {
+    constexpr auto LAN_DEVICE_ID = "88:B6:27:00:00:01";
+    constexpr auto LAN_DEVICE_ADDRESS = "192.168.0.10";
+    constexpr auto LOGIN_REQUEST = "http://192.168.0.10/login.html\npw=***";
+    constexpr auto LOGOUT_REQUEST = "http://192.168.0.10/login.html";
+
+    auto trace_path() -> std::filesystem::path
+    {
+        return std::filesystem::temp_directory_path() / "sokketter-cli-tests-io-trace.bin";
+    }
+} // namespace
+
+TEST(io_trace_tests, replay_lan_power_strip)
+{
+    {
+        trace_writer writer(trace_path(), LAN_DEVICE_ID);
+
+        writer.write_record(RECORD_DEVICE,
+            static_cast<uint16_t>(sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN),
+            LAN_DEVICE_ADDRESS, "Field capture");
+
+        /**
+         * Status query: login returning the status page, then logout.
+         */
+        writer.write_record(RECORD_HTTP_POST, 0, LOGIN_REQUEST, "sockstates = [1,0,0,0];");
+        writer.write_record(RECORD_HTTP_GET, 0, LOGOUT_REQUEST, "");
+
+        /**
+         * Switching socket 3 on: login, switch request echoing the new states, then logout.
+         */
+        writer.write_record(RECORD_HTTP_POST, 0, LOGIN_REQUEST, "sockstates = [1,0,0,0];");
+        writer.write_record(
+            RECORD_HTTP_POST, 0, "http://192.168.0.10/\ncte3=1", "sockstates = [1,0,1,0];");
+        writer.write_record(RECORD_HTTP_GET, 0, LOGOUT_REQUEST, "");
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    const auto &device = devices.front();
+    EXPECT_EQ(device->configuration().type, sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN);
+    EXPECT_EQ(device->configuration().id, LAN_DEVICE_ID);
+    EXPECT_EQ(device->configuration().address, LAN_DEVICE_ADDRESS);
+    EXPECT_TRUE(device->is_connected());
+
+    ASSERT_TRUE(device->socket(0).has_value());
+    EXPECT_TRUE(device->socket(0)->get().is_powered_on());
+    EXPECT_FALSE(device->socket(1)->get().is_powered_on());
+
+    EXPECT_TRUE(device->socket(2)->get().power(true));
+    EXPECT_TRUE(device->socket(2)->get().is_powered_on());
+
+    /**
+     * @attention the trace is exhausted, so further device exchanges fail instead of reaching
+     * the network.
+     */
+    EXPECT_FALSE(device->try_authenticate());
+
+    std::filesystem::remove(trace_path());
+}
+
+TEST(io_trace_tests, replay_lan_status_page_with_spaced_states)
+{
+    {
+        trace_writer writer(trace_path(), LAN_DEVICE_ID);
+
+        writer.write_record(RECORD_DEVICE,
+            static_cast<uint16_t>(sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN),
+            LAN_DEVICE_ADDRESS, "Field capture");
+
+        /**
+         * @attention the declaration overlaps a partial one, which must not hide it.
+         */
+        writer.write_record(RECORD_HTTP_POST, 0, LOGIN_REQUEST,
+            "<script>var socksockstates = [ 0 ,\n 1, 0,1 ];</script>");
+        writer.write_record(RECORD_HTTP_GET, 0, LOGOUT_REQUEST, "");
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    const auto &device = devices.front();
+    EXPECT_FALSE(device->socket(0)->get().is_powered_on());
+    EXPECT_TRUE(device->socket(1)->get().is_powered_on());
+    EXPECT_FALSE(device->socket(2)->get().is_powered_on());
+    EXPECT_TRUE(device->socket(3)->get().is_powered_on());
+
+    std::filesystem::remove(trace_path());
+}
+
+TEST(io_trace_tests, replay_rejects_invalid_file)
+{
+    {
+        std::ofstream file(trace_path(), std::ios::binary | std::ios::trunc);
+        file << "not a trace";
+    }
+
+    EXPECT_TRUE(sokketter::replay_io_trace(trace_path(), 0).empty());
+    EXPECT_TRUE(sokketter::replay_io_trace(trace_path().string() + ".missing", 0).empty());
+
+    std::filesystem::remove(trace_path());
+}
+
+TEST(io_trace_tests, recording_writes_trace_header)
+{
+    ASSERT_TRUE(sokketter::start_io_trace(trace_path()));
+    sokketter::stop_io_trace();
+
+    std::ifstream file(trace_path(), std::ios::binary);
+    std::string magic(8, '\0');
+    file.read(magic.data(), magic.size());
+    EXPECT_EQ(magic, "SOKTRACE");
+
+    file.close();
+    std::filesystem::remove(trace_path());
+}
@@ -0,0 +1,101 @@
+#include "libsokketter.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace testing;
+
+namespace {
+    auto set_test_device_number(const char *value) -> void
+    {
+#ifdef _WIN32
+        _putenv_s("LIBSOKKETTER_TEST_DEVICE_NUMBER", value);
+#else
+        setenv("LIBSOKKETTER_TEST_DEVICE_NUMBER", value, 1);
+#endif
+    }
+
+    auto unset_test_device_number() -> void
+    {
+#ifdef _WIN32
+        _putenv_s("LIBSOKKETTER_TEST_DEVICE_NUMBER", "");
+#else
+        unsetenv("LIBSOKKETTER_TEST_DEVICE_NUMBER");
+#endif
+    }
+
+    /**
+     * @brief collects library log messages, called from the dispatcher thread in asynchronous
+     * mode.
+     */
+    class message_collector
+    {
+    public:
+        auto collect(const sokketter::callback_view_structure &response) -> void
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_messages.emplace_back(response.message);
+        }
+
+        auto messages() -> std::vector<std::string>
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            return m_messages;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::vector<std::string> m_messages;
+    };
+
+    constexpr auto INVALID_TEST_SERIAL_NUMBER = "TEST_SERIAL_NUMBER_INVALID";
+    constexpr auto EXPECTED_MESSAGE = "Failed reading test device index from the provided serial "
+                                      "number TEST_SERIAL_NUMBER_INVALID!";
+
+    /**
+     * @brief requests a test device by an invalid serial number, which is logged as a warning.
+     * @attention the message is above the debug level, so it is still compiled in when
+     * SOKKETTER_ENABLE_DEBUG_LOGGING is off.
+     */
+    auto log_invalid_test_device(const sokketter::logging_mode &mode) -> std::vector<std::string>
+    {
+        const auto previous_settings = sokketter::settings();
+
+        message_collector collector;
+
+        auto settings = previous_settings;
+        settings.logging_level = sokketter::logging_level::INFO;
+        settings.logging_view_callback =
+            [&collector](const sokketter::callback_view_structure &response) {
+                collector.collect(response);
+            };
+        settings.logging_mode = mode;
+        sokketter::set_settings(settings);
+
+        set_test_device_number("1");
+        EXPECT_EQ(sokketter::device(std::string(INVALID_TEST_SERIAL_NUMBER)), nullptr);
+        unset_test_device_number();
+
+        /**
+         * @attention replacing the settings delivers all queued messages before returning.
+         */
+        sokketter::set_settings(previous_settings);
+
+        return collector.messages();
+    }
+} // namespace
+
+TEST(logging_tests, synchronous_view_callback)
+{
+    EXPECT_THAT(log_invalid_test_device(sokketter::logging_mode::SYNCHRONOUS),
+        Contains(EXPECTED_MESSAGE));
+}
+
+TEST(logging_tests, asynchronous_view_callback)
+{
+    EXPECT_THAT(log_invalid_test_device(sokketter::logging_mode::ASYNCHRONOUS),
+        Contains(EXPECTED_MESSAGE));
+}
@@ -0,0 +1,139 @@
+#include "libsokketter.h"
+#include "settings_test.h"
+#include "trace_writer.h"
+
+#include <filesystem>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace {
+    constexpr auto USB_DEVICE_ID = "01:02:03:04:07";
+    constexpr auto LAN_DEVICE_ID = "88:B6:27:00:00:02";
+    constexpr auto LOGIN_REQUEST = "http://192.168.0.11/login.html\npw=***";
+    constexpr auto LOGOUT_REQUEST = "http://192.168.0.11/login.html";
+
+    /**
+     * @brief caches socket states for a minute, so the second reconciliation is served from the
+     * cache.
+     */
+    class reconciliation_test : public test_settings::settings_test
+    {
+    protected:
+        auto SetUp() -> void override
+        {
+            settings_test::SetUp();
+
+            auto settings = m_previous_settings;
+            settings.socket_state_cache_mode = sokketter::socket_state_cache_mode::TIME_TO_LIVE;
+            settings.socket_state_cache_ttl_msec = 60 * 1000;
+            sokketter::set_settings(settings);
+        }
+
+        auto TearDown() -> void override
+        {
+            settings_test::TearDown();
+            std::filesystem::remove(trace_path());
+        }
+
+        static auto trace_path() -> std::filesystem::path
+        {
+            return std::filesystem::temp_directory_path() /
+                   "sokketter-cli-tests-reconciliation.bin";
+        }
+    };
+} // namespace
+
+TEST_F(reconciliation_test, only_differing_sockets_are_switched)
+{
+    {
+        test_trace::usb_trace_writer writer(trace_path(), USB_DEVICE_ID);
+
+        /**
+         * First reconciliation: both sockets are read, only the first one is switched and read
+         * back.
+         */
+        writer.write_status(1, false);
+        writer.write_status(2, false);
+        writer.write_switch(1);
+        writer.write_status(1, true);
+
+        /**
+         * Second reconciliation: the first socket is served from the cache, the second one was
+         * dropped from it by the verification and is read again.
+         */
+        writer.write_status(2, false);
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    const sokketter::desired_socket_states desired_states = {
+        {USB_DEVICE_ID, {{0, true}, {1, false}, {7, true}}}, {"UNKNOWN", {{0, true}}}};
+
+    const auto &report = sokketter::reconcile(devices, desired_states);
+    ASSERT_EQ(report.size(), 4);
+
+    EXPECT_EQ(report[0].device_id, USB_DEVICE_ID);
+    EXPECT_EQ(report[0].socket_index, 0);
+    EXPECT_EQ(report[0].result, sokketter::reconciliation_result::SWITCHED);
+    EXPECT_EQ(report[1].result, sokketter::reconciliation_result::UNCHANGED);
+    EXPECT_EQ(report[2].result, sokketter::reconciliation_result::UNKNOWN_SOCKET);
+    EXPECT_EQ(report[3].device_id, "UNKNOWN");
+    EXPECT_EQ(report[3].result, sokketter::reconciliation_result::UNKNOWN_DEVICE);
+
+    /**
+     * @attention the trace holds no further switch, so any write fails the second reconciliation.
+     */
+    const auto &second_report = sokketter::reconcile(devices, desired_states);
+    ASSERT_EQ(second_report.size(), 4);
+    EXPECT_EQ(second_report[0].result, sokketter::reconciliation_result::UNCHANGED);
+    EXPECT_EQ(second_report[1].result, sokketter::reconciliation_result::UNCHANGED);
+}
+
+TEST_F(reconciliation_test, lan_sockets_are_switched_in_one_request)
+{
+    {
+        test_trace::trace_writer writer(trace_path(), LAN_DEVICE_ID);
+
+        writer.write_record(test_trace::RECORD_DEVICE,
+            static_cast<uint16_t>(sokketter::power_strip_type::ENERGENIE_EG_PMXX_LAN),
+            "192.168.0.11", "Bench");
+
+        /**
+         * Status query answering the states of all sockets.
+         */
+        writer.write_record(
+            test_trace::RECORD_HTTP_POST, 0, LOGIN_REQUEST, "sockstates = [0,1,0,0];");
+        writer.write_record(test_trace::RECORD_HTTP_GET, 0, LOGOUT_REQUEST, "");
+
+        /**
+         * A single switch request for all differing sockets.
+         */
+        writer.write_record(
+            test_trace::RECORD_HTTP_POST, 0, LOGIN_REQUEST, "sockstates = [0,1,0,0];");
+        writer.write_record(test_trace::RECORD_HTTP_POST, 0,
+            "http://192.168.0.11/\ncte1=1&cte2=0&cte3=1", "sockstates = [1,0,1,0];");
+        writer.write_record(test_trace::RECORD_HTTP_GET, 0, LOGOUT_REQUEST, "");
+
+        /**
+         * Read back of the switched sockets.
+         */
+        writer.write_record(
+            test_trace::RECORD_HTTP_POST, 0, LOGIN_REQUEST, "sockstates = [1,0,1,0];");
+        writer.write_record(test_trace::RECORD_HTTP_GET, 0, LOGOUT_REQUEST, "");
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    const auto &report = sokketter::reconcile(
+        devices, {{LAN_DEVICE_ID, {{0, true}, {1, false}, {2, true}, {3, false}}}});
+    ASSERT_EQ(report.size(), 4);
+
+    EXPECT_EQ(report[0].result, sokketter::reconciliation_result::SWITCHED);
+    EXPECT_EQ(report[1].result, sokketter::reconciliation_result::SWITCHED);
+    EXPECT_EQ(report[2].result, sokketter::reconciliation_result::SWITCHED);
+    EXPECT_EQ(report[3].result, sokketter::reconciliation_result::UNCHANGED);
+}
@@ -0,0 +1,176 @@
+#include "libsokketter.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace testing;
+
+namespace {
+    constexpr auto GROUP_NAME = "bench-3";
+    constexpr auto SCENE_NAME = "bench-3-flashing";
+
+    constexpr auto FIRST_DEVICE_ID = "TEST_SERIAL_NUMBER_0";
+    constexpr auto SECOND_DEVICE_ID = "TEST_SERIAL_NUMBER_1";
+
+    auto set_test_device_number(const char *value) -> void
+    {
+#ifdef _WIN32
+        _putenv_s("LIBSOKKETTER_TEST_DEVICE_NUMBER", value);
+#else
+        setenv("LIBSOKKETTER_TEST_DEVICE_NUMBER", value, 1);
+#endif
+    }
+
+    auto unset_test_device_number() -> void
+    {
+#ifdef _WIN32
+        _putenv_s("LIBSOKKETTER_TEST_DEVICE_NUMBER", "");
+#else
+        unsetenv("LIBSOKKETTER_TEST_DEVICE_NUMBER");
+#endif
+    }
+
+    auto read_database() -> std::string
+    {
+        std::ifstream file(std::getenv("LIBSOKKETTER_TEST_DATABASE_PATH"));
+
+        std::stringstream content;
+        content << file.rdbuf();
+
+        return content.str();
+    }
+
+    /**
+     * @brief forgets the stored groups and scenes, so tests do not see each other's entries.
+     */
+    class socket_groups_test : public testing::Test
+    {
+    protected:
+        auto TearDown() -> void override
+        {
+            unset_test_device_number();
+
+            sokketter::forget_group(GROUP_NAME);
+            sokketter::forget_scene(SCENE_NAME);
+        }
+
+        static auto bench_group() -> sokketter::socket_group
+        {
+            sokketter::socket_group group;
+            group.name = GROUP_NAME;
+            group.sockets = {{FIRST_DEVICE_ID, 0}, {SECOND_DEVICE_ID, 2}};
+
+            return group;
+        }
+    };
+} // namespace
+
+TEST_F(socket_groups_test, group_is_persisted_in_device_database)
+{
+    sokketter::save_group(bench_group());
+
+    EXPECT_THAT(read_database(), HasSubstr(GROUP_NAME));
+
+    /**
+     * @attention reinitializing the library restores the database from the file.
+     */
+    ASSERT_TRUE(sokketter::deinitialize());
+    ASSERT_TRUE(sokketter::initialize());
+
+    const auto &groups = sokketter::groups();
+    ASSERT_EQ(groups.size(), 1);
+    EXPECT_EQ(groups.front().name, GROUP_NAME);
+    ASSERT_EQ(groups.front().sockets.size(), 2);
+    EXPECT_EQ(groups.front().sockets[1].device_id, SECOND_DEVICE_ID);
+    EXPECT_EQ(groups.front().sockets[1].socket_index, 2);
+
+    EXPECT_TRUE(sokketter::forget_group(GROUP_NAME));
+    EXPECT_FALSE(sokketter::forget_group(GROUP_NAME));
+    EXPECT_TRUE(sokketter::groups().empty());
+}
+
+TEST_F(socket_groups_test, legacy_device_list_is_loaded)
+{
+    ASSERT_TRUE(sokketter::deinitialize());
+
+    {
+        std::ofstream file(std::getenv("LIBSOKKETTER_TEST_DATABASE_PATH"), std::ios::trunc);
+        file << "[]";
+    }
+
+    ASSERT_TRUE(sokketter::initialize());
+
+    EXPECT_TRUE(sokketter::groups().empty());
+    EXPECT_TRUE(sokketter::scenes().empty());
+
+    sokketter::save_group(bench_group());
+
+    EXPECT_THAT(read_database(), HasSubstr("\"groups\""));
+}
+
+TEST_F(socket_groups_test, group_powers_sockets_across_devices)
+{
+    set_test_device_number("2");
+    sokketter::save_group(bench_group());
+
+    const auto devices = sokketter::devices();
+    ASSERT_EQ(devices.size(), 2);
+
+    const auto &report = sokketter::power_group(devices, GROUP_NAME, true);
+    ASSERT_EQ(report.size(), 2);
+    for (const auto &entry : report)
+    {
+        EXPECT_NE(entry.result, sokketter::reconciliation_result::FAILED);
+        EXPECT_TRUE(entry.is_powered_on);
+    }
+
+    EXPECT_TRUE(devices[0]->socket(0)->get().is_powered_on());
+    EXPECT_TRUE(devices[1]->socket(2)->get().is_powered_on());
+
+    /**
+     * @attention the sockets are on already, so nothing is switched again.
+     */
+    for (const auto &entry : sokketter::power_group(devices, GROUP_NAME, true))
+    {
+        EXPECT_EQ(entry.result, sokketter::reconciliation_result::UNCHANGED);
+    }
+
+    for (const auto &entry : sokketter::power_group(devices, GROUP_NAME, false))
+    {
+        EXPECT_EQ(entry.result, sokketter::reconciliation_result::SWITCHED);
+    }
+}
+
+TEST_F(socket_groups_test, scene_applies_its_states)
+{
+    set_test_device_number("2");
+
+    sokketter::socket_scene scene;
+    scene.name = SCENE_NAME;
+    scene.states = {{FIRST_DEVICE_ID, {{1, true}}}, {SECOND_DEVICE_ID, {{1, false}}}};
+    sokketter::save_scene(scene);
+
+    ASSERT_EQ(sokketter::scenes().size(), 1);
+    EXPECT_EQ(sokketter::scenes().front().states, scene.states);
+
+    const auto devices = sokketter::devices();
+    ASSERT_EQ(devices.size(), 2);
+
+    const auto &report = sokketter::apply_scene(devices, SCENE_NAME);
+    ASSERT_EQ(report.size(), 2);
+    EXPECT_TRUE(devices[0]->socket(1)->get().is_powered_on());
+    EXPECT_FALSE(devices[1]->socket(1)->get().is_powered_on());
+
+    devices[0]->socket(1)->get().power(false);
+}
+
+TEST_F(socket_groups_test, unknown_group_reports_nothing)
+{
+    EXPECT_TRUE(sokketter::power_group({}, GROUP_NAME, true).empty());
+    EXPECT_TRUE(sokketter::apply_scene({}, SCENE_NAME).empty());
+}
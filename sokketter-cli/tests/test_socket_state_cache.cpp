@@ -0,0 +1,170 @@
+#include "libsokketter.h"
+#include "settings_test.h"
+#include "trace_writer.h"
+
+#include <chrono>
+#include <filesystem>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing;
+
+namespace {
+    constexpr auto USB_DEVICE_ID = "01:02:03:04:05";
+
+    /**
+     * @brief switches the socket state cache mode of a replayed USB power strip.
+     */
+    class socket_state_cache_test : public test_settings::settings_test
+    {
+    protected:
+        auto TearDown() -> void override
+        {
+            settings_test::TearDown();
+            std::filesystem::remove(trace_path());
+        }
+
+        auto set_mode(const sokketter::socket_state_cache_mode &mode) -> void
+        {
+            auto settings = m_previous_settings;
+            settings.socket_state_cache_mode = mode;
+            settings.socket_state_cache_ttl_msec = 60 * 1000;
+            sokketter::set_settings(settings);
+        }
+
+        static auto trace_path() -> std::filesystem::path
+        {
+            return std::filesystem::temp_directory_path() / "sokketter-cli-tests-state-cache.bin";
+        }
+    };
+} // namespace
+
+TEST_F(socket_state_cache_test, always_read_queries_every_status)
+{
+    set_mode(sokketter::socket_state_cache_mode::ALWAYS_READ);
+
+    {
+        test_trace::usb_trace_writer writer(trace_path(), USB_DEVICE_ID);
+        writer.write_status(1, true);
+        writer.write_status(1, false);
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &socket = devices.front()->socket(0)->get();
+    EXPECT_TRUE(socket.is_powered_on());
+    EXPECT_FALSE(socket.is_powered_on());
+}
+
+TEST_F(socket_state_cache_test, time_to_live_serves_repeated_reads)
+{
+    set_mode(sokketter::socket_state_cache_mode::TIME_TO_LIVE);
+
+    {
+        test_trace::usb_trace_writer writer(trace_path(), USB_DEVICE_ID);
+        writer.write_status(1, true);
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &device = devices.front();
+    auto &socket = device->socket(0)->get();
+    EXPECT_TRUE(socket.is_powered_on());
+    EXPECT_TRUE(socket.is_powered_on());
+
+    /**
+     * @attention the trace is exhausted, so the read following the invalidation fails.
+     */
+    device->invalidate_socket_states();
+    EXPECT_FALSE(socket.is_powered_on());
+}
+
+TEST_F(socket_state_cache_test, successful_switch_is_written_through)
+{
+    set_mode(sokketter::socket_state_cache_mode::TRUST_LAST_WRITE);
+
+    {
+        test_trace::usb_trace_writer writer(trace_path(), USB_DEVICE_ID);
+        writer.write_status(2, false);
+        writer.write_switch(2);
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &socket = devices.front()->socket(1)->get();
+    EXPECT_TRUE(socket.toggle());
+    EXPECT_TRUE(socket.is_powered_on());
+}
+
+TEST_F(socket_state_cache_test, stale_state_is_returned_while_revalidated)
+{
+    auto settings = m_previous_settings;
+    settings.socket_state_cache_mode = sokketter::socket_state_cache_mode::STALE_WHILE_REVALIDATE;
+    settings.socket_state_cache_ttl_msec = 60 * 1000;
+    settings.socket_state_cache_ttl_msec_by_device = {{USB_DEVICE_ID, 0}};
+    sokketter::set_settings(settings);
+
+    {
+        test_trace::usb_trace_writer writer(trace_path(), USB_DEVICE_ID);
+        writer.write_status(1, true);
+        writer.write_status(1, false);
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &socket = devices.front()->socket(0)->get();
+
+    const auto &read_state = socket.state();
+    EXPECT_TRUE(read_state.is_valid);
+    EXPECT_TRUE(read_state.is_powered_on);
+
+    /**
+     * @attention the per-device TTL of 0 makes every cached state stale, so the previous state is
+     * served while the second recorded status is read in the background.
+     */
+    const auto &stale_state = socket.state();
+    EXPECT_TRUE(stale_state.is_valid);
+    EXPECT_TRUE(stale_state.is_powered_on);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (socket.state().is_powered_on && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_FALSE(socket.state().is_powered_on);
+}
+
+TEST_F(socket_state_cache_test, read_state_is_kept_as_last_known)
+{
+    set_mode(sokketter::socket_state_cache_mode::ALWAYS_READ);
+
+    {
+        test_trace::usb_trace_writer writer(trace_path(), USB_DEVICE_ID);
+        writer.write_status(2, true);
+    }
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &device = devices.front();
+    EXPECT_FALSE(device->last_known_socket_states()[1].is_valid);
+
+    EXPECT_TRUE(device->socket(1)->get().is_powered_on());
+
+    /**
+     * @attention the last known states outlive the invalidation of the cached ones.
+     */
+    device->invalidate_socket_states();
+
+    const auto &states = device->last_known_socket_states();
+    ASSERT_EQ(states.size(), 4);
+    EXPECT_FALSE(states[0].is_valid);
+    EXPECT_TRUE(states[1].is_valid);
+    EXPECT_TRUE(states[1].is_powered_on);
+}
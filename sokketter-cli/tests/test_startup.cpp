@@ -0,0 +1,101 @@
+#include "libsokketter.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace testing;
+
+namespace {
+    /**
+     * @attention the average startup is only reported, a wall-clock bound would fail on loaded
+     * machines.
+     */
+    constexpr size_t STARTUP_ITERATIONS = 20;
+
+    constexpr auto STORED_DEVICE_DATABASE = R"({"devices": [{"type": "GEMBIRD-SIS-PM",
+        "id": "01:02:03:04:07", "name": "Bench", "sockets": [{"name": "Socket 1"},
+        {"name": "Socket 2", "last-powered-on": true}, {"name": "Socket 3"},
+        {"name": "Socket 4", "last-powered-on": false}]}]})";
+
+    auto write_database(const std::string &content) -> void
+    {
+        std::ofstream file(std::getenv("LIBSOKKETTER_TEST_DATABASE_PATH"), std::ios::trunc);
+        file << content;
+    }
+
+    auto read_database() -> std::string
+    {
+        std::ifstream file(std::getenv("LIBSOKKETTER_TEST_DATABASE_PATH"));
+
+        std::stringstream content;
+        content << file.rdbuf();
+
+        return content.str();
+    }
+} // namespace
+
+TEST(startup_tests, test_initialize_and_deinitialize_cycle)
+{
+    ASSERT_TRUE(sokketter::deinitialize());
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t iteration = 0; iteration < STARTUP_ITERATIONS; ++iteration)
+    {
+        ASSERT_TRUE(sokketter::initialize());
+        ASSERT_TRUE(sokketter::deinitialize());
+    }
+
+    const auto average = std::chrono::duration_cast<std::chrono::microseconds>(
+        (std::chrono::steady_clock::now() - start) / STARTUP_ITERATIONS);
+
+    RecordProperty("average_startup_usec", std::to_string(average.count()));
+
+    ASSERT_TRUE(sokketter::initialize());
+}
+
+TEST(startup_tests, test_devices_are_available_after_restart)
+{
+    const auto device_count = sokketter::devices().size();
+
+    ASSERT_TRUE(sokketter::deinitialize());
+    ASSERT_TRUE(sokketter::initialize());
+
+    EXPECT_EQ(sokketter::devices().size(), device_count);
+}
+
+TEST(startup_tests, test_known_devices_are_listed_without_enumeration)
+{
+    ASSERT_TRUE(sokketter::deinitialize());
+    write_database(STORED_DEVICE_DATABASE);
+    ASSERT_TRUE(sokketter::initialize());
+
+    const auto &devices = sokketter::known_devices();
+    ASSERT_EQ(devices.size(), 1);
+    EXPECT_EQ(devices.front()->configuration().name, "Bench");
+    EXPECT_FALSE(devices.front()->is_connected());
+
+    const auto &states = devices.front()->last_known_socket_states();
+    ASSERT_EQ(states.size(), 4);
+    EXPECT_FALSE(states[0].is_valid);
+    EXPECT_TRUE(states[1].is_valid);
+    EXPECT_TRUE(states[1].is_powered_on);
+    EXPECT_TRUE(states[3].is_valid);
+    EXPECT_FALSE(states[3].is_powered_on);
+
+    /**
+     * @attention the last known states are written back when the database is saved.
+     */
+    ASSERT_TRUE(sokketter::deinitialize());
+    EXPECT_THAT(read_database(), HasSubstr("\"last-powered-on\": true"));
+
+    write_database("[]");
+    ASSERT_TRUE(sokketter::initialize());
+
+    EXPECT_TRUE(sokketter::known_devices().empty());
+}
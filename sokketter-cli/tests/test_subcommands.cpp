@@ -446,6 +446,33 @@ TEST(cli_subcommand_tests, test_power_status_via_index)
     ASSERT_EQ(err, "");
 }
 
+TEST(cli_subcommand_tests, test_power_status_with_timeout)
+{
+    // MAN-CLI-22
+    std::vector<char *> args = {(char *)"sokketter-cli", (char *)"power", (char *)"status",
+        (char *)"--device-at-index", (char *)"0", (char *)"--sockets", (char *)"1",
+        (char *)"--timeout-msec", (char *)"10000"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &return_code = cli_parser::parse_and_process(args.size(), args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    const auto device = first_available_device();
+    if (device == nullptr)
+    {
+        GTEST_SKIP() << "no device is available";
+    }
+
+    ASSERT_EQ(return_code, EXIT_SUCCESS);
+    ASSERT_EQ(
+        out, expected_device_header(device) + expected_selected_socket_status_output(device, {1}));
+    ASSERT_EQ(err, "");
+}
+
 TEST(cli_subcommand_tests, test_power_status_via_serial)
 {
     // MAN-CLI-08
@@ -894,3 +921,146 @@ TEST(cli_subcommand_tests, underscore_option_syntax)
         out, expected_device_header(device) + expected_selected_socket_status_output(device, {1}));
     ASSERT_EQ(err, "");
 }
+
+TEST(cli_subcommand_tests, add_device_with_address)
+{
+    // MAN-CLI-21
+    std::vector<char *> args = {(char *)"sokketter-cli", (char *)"add-device", (char *)"--ip",
+        (char *)"192.168.0.10", (char *)"--mac", (char *)"88-b6-27-01-02-03"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &return_code = cli_parser::parse_and_process(args.size(), args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    auto device = sokketter::device("88:B6:27:01:02:03");
+    ASSERT_NE(device, nullptr);
+
+    const auto configuration = device->configuration();
+
+    auto unregistered_configuration = configuration;
+    unregistered_configuration.is_registered = false;
+    device->configure(unregistered_configuration);
+    const bool is_still_registered = device->configuration().is_registered;
+
+    sokketter::forget_device(device);
+
+    ASSERT_EQ(return_code, EXIT_SUCCESS);
+    ASSERT_EQ(out, "Added device: " + device->to_string() + "\n");
+    ASSERT_EQ(err, "");
+
+    EXPECT_TRUE(device->is_connected());
+    EXPECT_TRUE(configuration.is_registered);
+    EXPECT_TRUE(is_still_registered);
+    EXPECT_EQ(configuration.address, "192.168.0.10");
+}
+
+TEST(cli_subcommand_tests, add_device_without_mac)
+{
+    std::vector<char *> args = {
+        (char *)"sokketter-cli", (char *)"add-device", (char *)"--ip", (char *)"192.168.0.10"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &return_code = cli_parser::parse_and_process(args.size(), args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    ASSERT_EQ(return_code, EXIT_FAILURE);
+    ASSERT_EQ(out, "");
+    ASSERT_EQ(err,
+        "Both --ip and --mac options are required.\nRun with --help for more information.\n");
+}
+
+TEST(cli_subcommand_tests, add_device_invalid_address)
+{
+    std::vector<char *> args = {(char *)"sokketter-cli", (char *)"add-device", (char *)"--ip",
+        (char *)"192.168.0.300", (char *)"--mac", (char *)"88:B6:27:01:02:03"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &return_code = cli_parser::parse_and_process(args.size(), args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    ASSERT_EQ(return_code, EXIT_FAILURE);
+    ASSERT_THAT(out, HasSubstr("'192.168.0.300' is not a valid IPv4 address!"));
+    ASSERT_EQ(
+        err, "Failed adding the device at 192.168.0.300 with MAC address 88:B6:27:01:02:03.\n");
+}
+
+TEST(cli_subcommand_tests, group_save_and_power_on)
+{
+    // MAN-CLI-23
+    set_test_device_number("1");
+
+    std::vector<char *> save_args = {(char *)"sokketter-cli", (char *)"group", (char *)"save",
+        (char *)"--name", (char *)"cli-bench", (char *)"--sockets",
+        (char *)"TEST_SERIAL_NUMBER_0/1"};
+    std::vector<char *> on_args = {(char *)"sokketter-cli", (char *)"group", (char *)"on",
+        (char *)"--name", (char *)"cli-bench"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &save_return_code =
+        cli_parser::parse_and_process(save_args.size(), save_args.data());
+    const auto &on_return_code = cli_parser::parse_and_process(on_args.size(), on_args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    const auto is_group_forgotten = sokketter::forget_group("cli-bench");
+    unset_test_device_number();
+
+    ASSERT_EQ(save_return_code, EXIT_SUCCESS);
+    ASSERT_EQ(on_return_code, EXIT_SUCCESS);
+    ASSERT_TRUE(is_group_forgotten);
+    ASSERT_THAT(out, HasSubstr("Saved group 'cli-bench'.\n"));
+    ASSERT_THAT(out, HasSubstr("Group 'cli-bench':\n  TEST_SERIAL_NUMBER_0 socket 1: on, "));
+    ASSERT_EQ(err, "");
+}
+
+TEST(cli_subcommand_tests, group_without_name)
+{
+    std::vector<char *> args = {(char *)"sokketter-cli", (char *)"group", (char *)"on"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &return_code = cli_parser::parse_and_process(args.size(), args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    ASSERT_EQ(return_code, EXIT_FAILURE);
+    ASSERT_EQ(out, "");
+    ASSERT_EQ(err, "--name option is required.\nRun with --help for more information.\n");
+}
+
+TEST(cli_subcommand_tests, scene_save_invalid_state)
+{
+    std::vector<char *> args = {(char *)"sokketter-cli", (char *)"scene", (char *)"save",
+        (char *)"--name", (char *)"cli-scene", (char *)"--sockets",
+        (char *)"TEST_SERIAL_NUMBER_0/1=dimmed"};
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+
+    const auto &return_code = cli_parser::parse_and_process(args.size(), args.data());
+
+    const auto &out = testing::internal::GetCapturedStdout();
+    const auto &err = testing::internal::GetCapturedStderr();
+
+    ASSERT_EQ(return_code, EXIT_FAILURE);
+    ASSERT_EQ(out, "");
+    ASSERT_EQ(err, "Socket 'TEST_SERIAL_NUMBER_0/1=dimmed' is not in DEVICE_ID/INDEX=on or "
+                   "DEVICE_ID/INDEX=off format.\n");
+}
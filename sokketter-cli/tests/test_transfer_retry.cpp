@@ -0,0 +1,122 @@
+#include "libsokketter.h"
+#include "settings_test.h"
+#include "trace_writer.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+
+namespace {
+    constexpr auto USB_DEVICE_ID = "01:02:03:04:06";
+
+    /**
+     * @brief writes a trace of a single Gembird SIS-PM whose first status read fails.
+     */
+    auto write_flaky_trace(const std::filesystem::path &path) -> void
+    {
+        test_trace::usb_trace_writer writer(path, USB_DEVICE_ID);
+        writer.write_status(1, true, false);
+        writer.write_status(1, true);
+    }
+
+    /**
+     * @brief applies a USB retry policy without jitter.
+     */
+    class transfer_retry_test : public test_settings::settings_test
+    {
+    protected:
+        auto TearDown() -> void override
+        {
+            settings_test::TearDown();
+            std::filesystem::remove(trace_path());
+        }
+
+        auto set_max_attempts(const uint32_t &max_attempts, const uint32_t &backoff_msec = 0)
+            -> void
+        {
+            auto settings = m_previous_settings;
+            settings.socket_state_cache_mode = sokketter::socket_state_cache_mode::ALWAYS_READ;
+            settings.usb_retry_policy.max_attempts = max_attempts;
+            settings.usb_retry_policy.initial_backoff_msec = backoff_msec;
+            settings.usb_retry_policy.max_backoff_msec = backoff_msec;
+            settings.usb_retry_policy.jitter = 0.0;
+            sokketter::set_settings(settings);
+        }
+
+        static auto trace_path() -> std::filesystem::path
+        {
+            return std::filesystem::temp_directory_path() / "sokketter-cli-tests-retry.bin";
+        }
+    };
+} // namespace
+
+TEST_F(transfer_retry_test, failed_transfer_is_retried)
+{
+    set_max_attempts(2);
+    write_flaky_trace(trace_path());
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    EXPECT_TRUE(devices.front()->socket(0)->get().is_powered_on());
+}
+
+TEST_F(transfer_retry_test, single_attempt_reports_failure)
+{
+    set_max_attempts(1);
+    write_flaky_trace(trace_path());
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &socket = devices.front()->socket(0)->get();
+    EXPECT_FALSE(socket.is_powered_on());
+
+    /**
+     * @attention the failed attempt consumed only its own record, so the next read succeeds.
+     */
+    EXPECT_TRUE(socket.is_powered_on());
+}
+
+TEST_F(transfer_retry_test, cancelled_call_skips_transfer)
+{
+    set_max_attempts(2);
+    write_flaky_trace(trace_path());
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &socket = devices.front()->socket(0)->get();
+
+    sokketter::call_options options;
+    options.cancellation.cancel();
+
+    EXPECT_FALSE(socket.state(options).is_valid);
+
+    /**
+     * @attention the cancelled call consumed no record, so the next read retries and succeeds.
+     */
+    EXPECT_TRUE(socket.state().is_powered_on);
+}
+
+TEST_F(transfer_retry_test, deadline_bounds_retries)
+{
+    set_max_attempts(3, 5000);
+    write_flaky_trace(trace_path());
+
+    const auto &devices = sokketter::replay_io_trace(trace_path(), 0);
+    ASSERT_EQ(devices.size(), 1);
+
+    auto &socket = devices.front()->socket(0)->get();
+
+    sokketter::call_options options;
+    options.timeout_msec = 100;
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(socket.state(options).is_valid);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+}
@@ -1,10 +1,13 @@
 #include "cli_parser.h"
 #include "libsokketter.h"
 
+#include <chrono>
 #include <fstream>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <iterator>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #ifdef _WIN32
@@ -127,3 +130,34 @@ TEST_F(update_notification_test, empty_cache_prints_nothing)
     ASSERT_EQ(return_code, EXIT_SUCCESS);
     ASSERT_EQ(err, "");
 }
+
+TEST_F(update_notification_test, recent_attempt_skips_update_check)
+{
+    const auto attempted_at = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                                  .count();
+
+    const std::string cache = "{\"attempted_at\":" + std::to_string(attempted_at) +
+                              ",\"checked_at\":\"\",\"new_version\":\"\",\"latest_version\":\"\"}";
+
+    {
+        std::ofstream file(m_cache_path);
+        file << cache;
+    }
+
+    unset_env("LIBSOKKETTER_TEST_SKIP_UPDATE_CHECK");
+
+    sokketter::check_for_update_async();
+
+    /**
+     * @attention deinitialize() joins the check thread, which would have rewritten the cache.
+     */
+    ASSERT_TRUE(sokketter::deinitialize());
+    ASSERT_TRUE(sokketter::initialize());
+
+    std::ifstream file(m_cache_path);
+    const std::string content(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    ASSERT_EQ(content, cache);
+}
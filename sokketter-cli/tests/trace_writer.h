@@ -0,0 +1,108 @@
+#ifndef SOKKETTER_CLI_TESTS_TRACE_WRITER_H
+#define SOKKETTER_CLI_TESTS_TRACE_WRITER_H
+
+#pragma once
+
+#include "libsokketter.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+namespace test_trace {
+    constexpr uint8_t RECORD_DEVICE = 1;
+    constexpr uint8_t RECORD_USB_CONTROL_READ = 2;
+    constexpr uint8_t RECORD_USB_CONTROL_WRITE = 3;
+    constexpr uint8_t RECORD_HTTP_GET = 4;
+    constexpr uint8_t RECORD_HTTP_POST = 5;
+
+    /**
+     * @brief writes trace files of a single power strip in the documented binary layout, as
+     * captured in the field.
+     */
+    class trace_writer
+    {
+    public:
+        trace_writer(const std::filesystem::path &path, std::string device_id)
+            : m_file(path, std::ios::binary | std::ios::trunc)
+            , m_device_id(std::move(device_id))
+        {
+            m_file.write("SOKTRACE", 8);
+            write_integer<uint16_t>(1);
+        }
+
+        auto write_record(const uint8_t type, const uint16_t value, const std::string &request,
+            const std::string &response, const bool is_successful = true) -> void
+        {
+            write_integer<uint8_t>(type);
+            write_integer<uint8_t>(is_successful ? 1 : 0);
+            write_integer<uint64_t>(0);
+            write_integer<uint64_t>(1000);
+            write_integer<uint8_t>(0);
+            write_integer<uint8_t>(0);
+            write_integer<uint16_t>(value);
+            write_integer<uint16_t>(0);
+            write_blob(m_device_id);
+            write_blob(request);
+            write_blob(response);
+        }
+
+    private:
+        std::ofstream m_file;
+        std::string m_device_id = "";
+
+        template <typename value_type>
+        auto write_integer(const value_type value) -> void
+        {
+            for (size_t index = 0; index < sizeof(value_type); ++index)
+            {
+                m_file.put(static_cast<char>((static_cast<uint64_t>(value) >> (8 * index)) & 0xff));
+            }
+        }
+
+        auto write_blob(const std::string &blob) -> void
+        {
+            write_integer<uint32_t>(static_cast<uint32_t>(blob.size()));
+            m_file.write(blob.data(), blob.size());
+        }
+    };
+
+    /**
+     * @brief writes a trace of a single Gembird SIS-PM, so the USB driver runs without hardware.
+     */
+    class usb_trace_writer : public trace_writer
+    {
+    public:
+        usb_trace_writer(const std::filesystem::path &path, std::string device_id)
+            : trace_writer(path, std::move(device_id))
+        {
+            write_record(RECORD_DEVICE,
+                static_cast<uint16_t>(sokketter::power_strip_type::GEMBIRD_SIS_PM), "USB:1-1",
+                "Field capture");
+        }
+
+        /**
+         * @brief records a status read of the socket answering with the given state.
+         */
+        auto write_status(const size_t &index, const bool &is_powered_on,
+            const bool is_successful = true) -> void
+        {
+            std::string response(5, '\0');
+            response[0] = static_cast<char>(3 * index);
+            response[1] = is_powered_on ? 0x03 : 0x02;
+
+            write_record(RECORD_USB_CONTROL_READ, static_cast<uint16_t>(0x0300 + 3 * index), "",
+                is_successful ? response : "", is_successful);
+        }
+
+        auto write_switch(const size_t &index) -> void
+        {
+            write_record(
+                RECORD_USB_CONTROL_WRITE, static_cast<uint16_t>(0x0300 + 3 * index), "", "");
+        }
+    };
+} // namespace test_trace
+
+#endif // SOKKETTER_CLI_TESTS_TRACE_WRITER_H
@@ -0,0 +1,139 @@
+#include "DashboardListModel.h"
+
+#include <Qt/ListItemDelegate.h>
+
+#include <QLedLabel.h>
+
+#include <algorithm>
+
+DashboardListModel::DashboardListModel(QObject *parent)
+    : QAbstractListModel(parent)
+{}
+
+auto DashboardListModel::rowCount(const QModelIndex &parent) const -> int
+{
+    return parent.isValid() ? 0 : int(m_entries.size());
+}
+
+auto DashboardListModel::data(const QModelIndex &index, int role) const -> QVariant
+{
+    if (!index.isValid() || index.row() >= int(m_entries.size()))
+    {
+        return {};
+    }
+
+    const auto &entry = m_entries[index.row()];
+
+    switch (role)
+    {
+    case Qt::DisplayRole: {
+        return "Socket " + QString::number(entry.socket_index + 1);
+    }
+    case Qt::ToolTipRole: {
+        switch (entry.state)
+        {
+        case QLedLabel::StateOk: {
+            return tr("powered on");
+        }
+        case QLedLabel::StateError: {
+            return tr("powered off");
+        }
+        default: {
+            return tr("unknown");
+        }
+        }
+    }
+    case ListItemDelegate::IconRole: {
+        return QStringLiteral("socket_icon");
+    }
+    case ListItemDelegate::TitleSuffixRole: {
+        return ": " + QString::fromStdString(entry.configuration.name);
+    }
+    case ListItemDelegate::DetailRole: {
+        return "of " + entry.device_name;
+    }
+    case ListItemDelegate::DescriptionRole: {
+        return QString::fromStdString(entry.configuration.description);
+    }
+    case ListItemDelegate::StateRole: {
+        return entry.state;
+    }
+    default: {
+        return {};
+    }
+    }
+}
+
+auto DashboardListModel::flags(const QModelIndex &index) const -> Qt::ItemFlags
+{
+    if (!index.isValid() || index.row() >= int(m_entries.size()))
+    {
+        return Qt::NoItemFlags;
+    }
+
+    return Qt::ItemIsEnabled;
+}
+
+auto DashboardListModel::set_power_strips(
+    const std::vector<std::shared_ptr<sokketter::power_strip>> &power_strips) -> void
+{
+    beginResetModel();
+
+    m_entries.clear();
+    m_device_rows.clear();
+
+    for (const auto &power_strip : power_strips)
+    {
+        if (!power_strip->is_connected())
+        {
+            continue;
+        }
+
+        const auto &configuration = power_strip->configuration();
+        const auto &sockets = power_strip->sockets();
+
+        m_device_rows[configuration.id] = {int(m_entries.size()), int(sockets.size())};
+
+        for (size_t socket_index = 0; socket_index < sockets.size(); ++socket_index)
+        {
+            m_entries.push_back({QString::fromStdString(configuration.name),
+                sockets[socket_index].configuration(), socket_index, QLedLabel::StateUnknown});
+        }
+    }
+
+    endResetModel();
+}
+
+auto DashboardListModel::set_states(
+    const std::string &device_id, const std::vector<sokketter::socket_state> &states) -> void
+{
+    const auto it = m_device_rows.find(device_id);
+    if (it == m_device_rows.end())
+    {
+        return;
+    }
+
+    const auto &[first_row, row_count] = it->second;
+
+    const int count = std::min(int(states.size()), row_count);
+    for (int offset = 0; offset < count; ++offset)
+    {
+        if (!states[offset].is_valid)
+        {
+            continue;
+        }
+
+        auto &entry = m_entries[first_row + offset];
+
+        const int state = states[offset].is_powered_on ? QLedLabel::StateOk : QLedLabel::StateError;
+        if (entry.state == state)
+        {
+            continue;
+        }
+
+        entry.state = state;
+
+        const auto &model_index = index(first_row + offset);
+        emit dataChanged(model_index, model_index);
+    }
+}
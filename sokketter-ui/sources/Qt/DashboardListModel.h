@@ -0,0 +1,60 @@
+#ifndef DASHBOARDLISTMODEL_H
+#define DASHBOARDLISTMODEL_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <QAbstractListModel>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief sockets of all connected power strips shown on the dashboard, painted by
+ * ListItemDelegate.
+ */
+class DashboardListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit DashboardListModel(QObject *parent = nullptr);
+
+    auto rowCount(const QModelIndex &parent = QModelIndex()) const -> int override;
+    auto data(const QModelIndex &index, int role = Qt::DisplayRole) const -> QVariant override;
+    auto flags(const QModelIndex &index) const -> Qt::ItemFlags override;
+
+    /**
+     * @brief lists the sockets of the connected power strips with unknown states.
+     */
+    auto set_power_strips(const std::vector<std::shared_ptr<sokketter::power_strip>> &power_strips)
+        -> void;
+
+    /**
+     * @brief applies the states read from a single power strip in socket order, only the rows
+     * whose state changed are repainted and states that could not be read are skipped.
+     */
+    auto set_states(const std::string &device_id,
+        const std::vector<sokketter::socket_state> &states) -> void;
+
+private:
+    struct entry
+    {
+        QString device_name;
+        sokketter::socket_configuration configuration;
+        size_t socket_index = 0;
+        int state = 0;
+    };
+
+    std::vector<entry> m_entries;
+
+    /**
+     * @brief first row and number of rows of each power strip, keyed by its id.
+     */
+    std::map<std::string, std::pair<int, int>> m_device_rows;
+};
+
+#endif // DASHBOARDLISTMODEL_H
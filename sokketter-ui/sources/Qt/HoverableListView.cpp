@@ -0,0 +1,90 @@
+#include "HoverableListView.h"
+
+#include <QEvent>
+
+HoverableListView::HoverableListView(QWidget *parent)
+    : QListView(parent)
+{
+    setMouseTracking(true);
+}
+
+auto HoverableListView::setModel(QAbstractItemModel *model) -> void
+{
+    if (this->model() != nullptr)
+    {
+        QObject::disconnect(this->model(), nullptr, this, nullptr);
+    }
+
+    QListView::setModel(model);
+
+    if (model != nullptr)
+    {
+        QObject::connect(model, &QAbstractItemModel::rowsInserted, this,
+            &HoverableListView::update_placeholder);
+        QObject::connect(model, &QAbstractItemModel::rowsRemoved, this,
+            &HoverableListView::update_placeholder);
+        QObject::connect(model, &QAbstractItemModel::modelReset, this,
+            &HoverableListView::update_placeholder);
+    }
+
+    update_placeholder();
+}
+
+auto HoverableListView::set_placeholder(QWidget *placeholder) -> void
+{
+    if (m_placeholder == placeholder)
+    {
+        return;
+    }
+
+    if (m_placeholder != nullptr)
+    {
+        m_placeholder->deleteLater();
+    }
+
+    m_placeholder = placeholder;
+    if (m_placeholder != nullptr)
+    {
+        m_placeholder->setParent(viewport());
+    }
+
+    update_placeholder();
+}
+
+auto HoverableListView::placeholder() const -> QWidget *
+{
+    return m_placeholder;
+}
+
+auto HoverableListView::event(QEvent *event) -> bool
+{
+    /**
+     * @attention rows are painted by the delegate, so they are repainted to pick up the new icons.
+     */
+    if (event->type() == QEvent::ThemeChange || event->type() == QEvent::PaletteChange)
+    {
+        viewport()->update();
+    }
+
+    return QListView::event(event);
+}
+
+auto HoverableListView::resizeEvent(QResizeEvent *event) -> void
+{
+    QListView::resizeEvent(event);
+
+    update_placeholder();
+}
+
+auto HoverableListView::update_placeholder() -> void
+{
+    if (m_placeholder == nullptr)
+    {
+        return;
+    }
+
+    const bool is_empty = model() == nullptr || model()->rowCount() == 0;
+
+    m_placeholder->setGeometry(viewport()->rect());
+    m_placeholder->setVisible(is_empty);
+}
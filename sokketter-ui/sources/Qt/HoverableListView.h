@@ -0,0 +1,34 @@
+#ifndef HOVERABLELISTVIEW_H
+#define HOVERABLELISTVIEW_H
+
+#pragma once
+
+#include <QListView>
+#include <QPointer>
+
+class HoverableListView : public QListView
+{
+    Q_OBJECT
+
+public:
+    HoverableListView(QWidget *parent = nullptr);
+
+    auto setModel(QAbstractItemModel *model) -> void override;
+
+    /**
+     * @brief sets the widget covering the view while the model has no rows.
+     */
+    auto set_placeholder(QWidget *placeholder) -> void;
+    auto placeholder() const -> QWidget *;
+
+protected:
+    auto event(QEvent *event) -> bool override;
+    auto resizeEvent(QResizeEvent *event) -> void override;
+
+private:
+    QPointer<QWidget> m_placeholder;
+
+    auto update_placeholder() -> void;
+};
+
+#endif // HOVERABLELISTVIEW_H
@@ -1,5 +0,0 @@
-#include "HoverableListWidget.h"
-
-HoverableListWidget::HoverableListWidget(QWidget *parent)
-    : QListWidget(parent)
-{}
@@ -0,0 +1,298 @@
+#include "ListItemDelegate.h"
+
+#include <QLedLabel.h>
+#include <theme_stylesheets.h>
+
+#include <QAbstractItemView>
+#include <QApplication>
+#include <QHelpEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QStyleOptionButton>
+#include <QToolTip>
+
+#include <algorithm>
+
+namespace {
+    auto led_color(const int &state) -> QColor
+    {
+        switch (state)
+        {
+        case QLedLabel::StateOk: {
+            return QColor(70, 167, 88);
+        }
+        case QLedLabel::StateWarning: {
+            return QColor(255, 197, 61);
+        }
+        case QLedLabel::StateError: {
+            return QColor(229, 72, 77);
+        }
+        default:
+        case QLedLabel::StateUnknown: {
+            return QColor(111, 109, 102);
+        }
+        }
+    }
+
+    auto reset_tooltip(const int &msecs) -> QString
+    {
+        int precision = 0;
+        if (msecs % 1000 != 0)
+        {
+            if (msecs % 100 == 0)
+            {
+                precision = 1;
+            }
+            else if (msecs % 10 == 0)
+            {
+                precision = 2;
+            }
+            else
+            {
+                precision = 3;
+            }
+        }
+
+        return QString::number(msecs / 1000.0, 'f', precision) + " seconds";
+    }
+
+    auto title_font(const QFont &font) -> QFont
+    {
+        QFont bold_font = font;
+        bold_font.setBold(true);
+
+        return bold_font;
+    }
+
+    /**
+     * @brief gets the non-empty lines below the title.
+     */
+    auto detail_lines(const QModelIndex &index) -> QStringList
+    {
+        QStringList lines;
+
+        for (const int role : {ListItemDelegate::DetailRole, ListItemDelegate::DescriptionRole})
+        {
+            const QString &line = index.data(role).toString();
+            if (!line.isEmpty())
+            {
+                lines.append(line);
+            }
+        }
+
+        return lines;
+    }
+} // namespace
+
+ListItemDelegate::ListItemDelegate(QObject *parent)
+    : QStyledItemDelegate(parent)
+{}
+
+auto ListItemDelegate::paint(
+    QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const -> void
+{
+    QStyleOptionViewItem item_option = option;
+    initStyleOption(&item_option, index);
+    item_option.text.clear();
+    item_option.icon = QIcon();
+
+    const QWidget *widget = option.widget;
+    QStyle *style = widget != nullptr ? widget->style() : QApplication::style();
+
+    /**
+     * @attention only the row panel is drawn by the style, so the stylesheet hover and selection
+     * colors still apply.
+     */
+    style->drawPrimitive(QStyle::PE_PanelItemViewItem, &item_option, painter, widget);
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setRenderHint(QPainter::SmoothPixmapTransform);
+
+    const QRect content = option.rect.adjusted(MARGIN, MARGIN, -MARGIN, -MARGIN);
+    const int center_y = content.center().y();
+
+    const QRect icon_rect(content.left(), center_y - ICON_SIZE / 2, ICON_SIZE, ICON_SIZE);
+    painter->drawPixmap(icon_rect, icon(index.data(IconRole).toString()));
+
+    const QRect led_rect(
+        icon_rect.right() + 1 + SPACING, center_y - LED_SIZE / 2, LED_SIZE, LED_SIZE);
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(led_color(index.data(StateRole).toInt()));
+    painter->drawEllipse(led_rect);
+
+    const bool is_enabled = option.state.testFlag(QStyle::State_Enabled);
+
+    int text_right = content.right();
+    if (index.data(ResetMsecRole).toInt() > 0)
+    {
+        const QRect button_rect = reset_button_rect(option.rect);
+        text_right = button_rect.left() - SPACING;
+
+        QFont button_font = option.font;
+        button_font.setPointSize(10);
+        button_font.setBold(true);
+
+        QStyleOptionButton button;
+        button.rect = button_rect;
+        button.text = QString::fromUtf8("↺");
+        button.fontMetrics = QFontMetrics(button_font);
+        button.palette = option.palette;
+        button.state = QStyle::State_Raised;
+        if (is_enabled && index.data(ResetEnabledRole).toBool())
+        {
+            button.state |= QStyle::State_Enabled;
+        }
+
+        painter->setFont(button_font);
+        style->drawControl(QStyle::CE_PushButton, &button, painter, widget);
+    }
+
+    const QPalette::ColorGroup color_group = is_enabled ? QPalette::Normal : QPalette::Disabled;
+    const QColor text_color = option.palette.color(color_group, QPalette::Text);
+
+    QColor detail_color = text_color;
+    detail_color.setAlphaF(0.6);
+
+    const QFont bold_font = title_font(option.font);
+    const QFontMetrics bold_metrics(bold_font);
+    const QFontMetrics metrics(option.font);
+
+    const QStringList &lines = detail_lines(index);
+
+    const int text_left = led_rect.right() + 1 + SPACING;
+    const int text_width = std::max(text_right - text_left, 0);
+    const int text_height = bold_metrics.height() + metrics.height() * int(lines.size());
+
+    int line_top = center_y - text_height / 2;
+
+    /**
+     * @brief title line: bold title followed by the regular suffix.
+     */
+    const QString &title =
+        bold_metrics.elidedText(index.data(Qt::DisplayRole).toString(), Qt::ElideRight, text_width);
+    const int title_width = bold_metrics.horizontalAdvance(title);
+
+    painter->setPen(text_color);
+    painter->setFont(bold_font);
+    painter->drawText(QRect(text_left, line_top, title_width, bold_metrics.height()),
+        Qt::AlignLeft | Qt::AlignVCenter, title);
+
+    const QString &suffix = metrics.elidedText(
+        index.data(TitleSuffixRole).toString(), Qt::ElideRight, text_width - title_width);
+    if (!suffix.isEmpty())
+    {
+        painter->setFont(option.font);
+        painter->drawText(QRect(text_left + title_width, line_top, text_width - title_width,
+                              bold_metrics.height()),
+            Qt::AlignLeft | Qt::AlignVCenter, suffix);
+    }
+
+    line_top += bold_metrics.height();
+
+    painter->setPen(detail_color);
+    painter->setFont(option.font);
+    for (const auto &line : lines)
+    {
+        painter->drawText(QRect(text_left, line_top, text_width, metrics.height()),
+            Qt::AlignLeft | Qt::AlignVCenter, metrics.elidedText(line, Qt::ElideRight, text_width));
+        line_top += metrics.height();
+    }
+
+    painter->restore();
+}
+
+auto ListItemDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+    -> QSize
+{
+    const QFontMetrics bold_metrics(title_font(option.font));
+    const QFontMetrics metrics(option.font);
+
+    const int text_height =
+        bold_metrics.height() + metrics.height() * int(detail_lines(index).size());
+
+    int width = 2 * MARGIN + ICON_SIZE + SPACING + LED_SIZE + SPACING;
+    if (index.data(ResetMsecRole).toInt() > 0)
+    {
+        width += SPACING + RESET_BUTTON_SIZE;
+    }
+
+    /**
+     * @attention rows span the visible width, the view lays them out again once it is resized.
+     */
+    const auto *view = qobject_cast<const QAbstractItemView *>(option.widget);
+    if (view != nullptr)
+    {
+        width = std::max(width, view->viewport()->width());
+    }
+
+    return QSize(width, std::max(ICON_SIZE, text_height) + 2 * MARGIN);
+}
+
+auto ListItemDelegate::editorEvent(QEvent *event, QAbstractItemModel *model,
+    const QStyleOptionViewItem &option, const QModelIndex &index) -> bool
+{
+    const bool is_mouse_event = event->type() == QEvent::MouseButtonPress ||
+                                event->type() == QEvent::MouseButtonRelease ||
+                                event->type() == QEvent::MouseButtonDblClick;
+
+    if (is_mouse_event)
+    {
+        const auto *mouse_event = static_cast<QMouseEvent *>(event);
+        if (is_reset_button_hit(index, option.rect, mouse_event->position().toPoint()))
+        {
+            if (event->type() == QEvent::MouseButtonRelease &&
+                mouse_event->button() == Qt::LeftButton &&
+                option.state.testFlag(QStyle::State_Enabled) &&
+                index.data(ResetEnabledRole).toBool())
+            {
+                emit resetRequested(index);
+            }
+
+            return true;
+        }
+    }
+
+    return QStyledItemDelegate::editorEvent(event, model, option, index);
+}
+
+auto ListItemDelegate::helpEvent(QHelpEvent *event, QAbstractItemView *view,
+    const QStyleOptionViewItem &option, const QModelIndex &index) -> bool
+{
+    if (event->type() == QEvent::ToolTip && is_reset_button_hit(index, option.rect, event->pos()))
+    {
+        QToolTip::showText(
+            event->globalPos(), reset_tooltip(index.data(ResetMsecRole).toInt()), view);
+        return true;
+    }
+
+    return QStyledItemDelegate::helpEvent(event, view, option, index);
+}
+
+auto ListItemDelegate::is_reset_button_hit(
+    const QModelIndex &index, const QRect &rect, const QPoint &position) const -> bool
+{
+    return index.isValid() && index.data(ResetMsecRole).toInt() > 0 &&
+           reset_button_rect(rect).contains(position);
+}
+
+auto ListItemDelegate::icon(const QString &name) const -> const QPixmap &
+{
+    const QString &path = ":/icons/" + name + (isDarkMode() ? "_white.png" : "_black.png");
+
+    auto it = m_icons.find(path);
+    if (it == m_icons.end())
+    {
+        it = m_icons.insert(path, QPixmap(path));
+    }
+
+    return it.value();
+}
+
+auto ListItemDelegate::reset_button_rect(const QRect &rect) -> QRect
+{
+    const QRect content = rect.adjusted(MARGIN, MARGIN, -MARGIN, -MARGIN);
+
+    return QRect(content.right() + 1 - RESET_BUTTON_SIZE,
+        content.center().y() - RESET_BUTTON_SIZE / 2, RESET_BUTTON_SIZE, RESET_BUTTON_SIZE);
+}
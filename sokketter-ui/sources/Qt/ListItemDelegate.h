@@ -0,0 +1,86 @@
+#ifndef LISTITEMDELEGATE_H
+#define LISTITEMDELEGATE_H
+
+#pragma once
+
+#include <QHash>
+#include <QPixmap>
+#include <QStyledItemDelegate>
+
+/**
+ * @brief paints power strip and socket rows from the model data, so the lists create no widget per
+ * row and only paint the visible ones.
+ */
+class ListItemDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief data roles painted next to Qt::DisplayRole, which holds the bold title.
+     */
+    enum Role
+    {
+        /**
+         * @brief QString, icon resource name without the theme suffix, e.g. "socket_icon".
+         */
+        IconRole = Qt::UserRole + 1,
+
+        /**
+         * @brief QString, regular text following the bold title.
+         */
+        TitleSuffixRole,
+
+        /**
+         * @brief QString, second and third line below the title.
+         */
+        DetailRole,
+        DescriptionRole,
+
+        /**
+         * @brief int, QLedLabel::State of the status LED.
+         */
+        StateRole,
+
+        /**
+         * @brief int, configurable reset duration; the reset button is painted for non-zero values.
+         */
+        ResetMsecRole,
+        ResetEnabledRole,
+    };
+
+    explicit ListItemDelegate(QObject *parent = nullptr);
+
+    auto paint(QPainter *painter, const QStyleOptionViewItem &option,
+        const QModelIndex &index) const -> void override;
+    auto sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+        -> QSize override;
+
+    auto editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option,
+        const QModelIndex &index) -> bool override;
+    auto helpEvent(QHelpEvent *event, QAbstractItemView *view, const QStyleOptionViewItem &option,
+        const QModelIndex &index) -> bool override;
+
+    /**
+     * @brief checks whether the position within the row rectangle hits the reset button of the row.
+     */
+    auto is_reset_button_hit(
+        const QModelIndex &index, const QRect &rect, const QPoint &position) const -> bool;
+
+signals:
+    auto resetRequested(const QModelIndex &index) -> void;
+
+private:
+    inline static constexpr int MARGIN = 5;
+    inline static constexpr int SPACING = 20;
+    inline static constexpr int ICON_SIZE = 58;
+    inline static constexpr int LED_SIZE = 8;
+    inline static constexpr int RESET_BUTTON_SIZE = 24;
+
+    mutable QHash<QString, QPixmap> m_icons;
+
+    auto icon(const QString &name) const -> const QPixmap &;
+    static auto reset_button_rect(const QRect &rect) -> QRect;
+};
+
+#endif // LISTITEMDELEGATE_H
@@ -0,0 +1,194 @@
+#include "PowerStripListModel.h"
+
+#include <Qt/ListItemDelegate.h>
+
+#include <QLedLabel.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+    /**
+     * @brief checks whether the row painted for the configuration would change.
+     */
+    auto is_shown_differently(const sokketter::power_strip_configuration &first,
+        const sokketter::power_strip_configuration &second) -> bool
+    {
+        return first.type != second.type || first.name != second.name ||
+               first.description != second.description || first.address != second.address;
+    }
+} // namespace
+
+PowerStripListModel::PowerStripListModel(QObject *parent)
+    : QAbstractListModel(parent)
+{}
+
+auto PowerStripListModel::rowCount(const QModelIndex &parent) const -> int
+{
+    return parent.isValid() ? 0 : int(m_entries.size());
+}
+
+auto PowerStripListModel::data(const QModelIndex &index, int role) const -> QVariant
+{
+    if (!index.isValid() || index.row() >= int(m_entries.size()))
+    {
+        return {};
+    }
+
+    const auto &entry = m_entries[index.row()];
+
+    switch (role)
+    {
+    case Qt::DisplayRole: {
+        return QString::fromStdString(entry.configuration.name);
+    }
+    case Qt::ToolTipRole: {
+        if (entry.is_connected)
+        {
+            return tr("connected");
+        }
+
+        return m_is_enumerating ? tr("pending") : tr("disconnected");
+    }
+    case ListItemDelegate::IconRole: {
+        return QStringLiteral("power_strip_icon");
+    }
+    case ListItemDelegate::DetailRole: {
+        auto type_n_address = QString::fromStdString(
+            sokketter::power_strip_type_to_string(entry.configuration.type));
+        if (!entry.configuration.address.empty())
+        {
+            type_n_address +=
+                ", available at " + QString::fromStdString(entry.configuration.address);
+        }
+
+        return type_n_address;
+    }
+    case ListItemDelegate::DescriptionRole: {
+        return QString::fromStdString(entry.configuration.description);
+    }
+    case ListItemDelegate::StateRole: {
+        if (entry.is_connected)
+        {
+            return int(QLedLabel::StateOk);
+        }
+
+        return int(m_is_enumerating ? QLedLabel::StateWarning : QLedLabel::StateError);
+    }
+    default: {
+        return {};
+    }
+    }
+}
+
+auto PowerStripListModel::set_power_strips(
+    const std::vector<std::shared_ptr<sokketter::power_strip>> &power_strips) -> void
+{
+    std::unordered_set<std::string> ids;
+    for (const auto &power_strip : power_strips)
+    {
+        ids.insert(power_strip->configuration().id);
+    }
+
+    /**
+     * @brief remove the vanished power strips, last to first so the remaining rows keep their
+     * numbers.
+     */
+    for (int row = int(m_entries.size()) - 1; row >= 0; --row)
+    {
+        if (ids.count(m_entries[row].configuration.id) != 0)
+        {
+            continue;
+        }
+
+        beginRemoveRows(QModelIndex(), row, row);
+        m_entries.erase(m_entries.begin() + row);
+        endRemoveRows();
+    }
+
+    std::unordered_map<std::string, int> rows;
+    for (size_t row = 0; row < m_entries.size(); ++row)
+    {
+        rows[m_entries[row].configuration.id] = int(row);
+    }
+
+    /**
+     * @brief update the known power strips in place and append the new ones, so the rows that did
+     * not change are neither repainted nor moved.
+     */
+    for (const auto &power_strip : power_strips)
+    {
+        const auto &configuration = power_strip->configuration();
+        const bool is_connected = power_strip->is_connected();
+
+        const auto it = rows.find(configuration.id);
+        if (it == rows.end())
+        {
+            const int row = int(m_entries.size());
+
+            beginInsertRows(QModelIndex(), row, row);
+            m_entries.push_back({configuration, is_connected});
+            endInsertRows();
+
+            rows[configuration.id] = row;
+            continue;
+        }
+
+        auto &entry = m_entries[it->second];
+        const bool is_changed = entry.is_connected != is_connected ||
+                                is_shown_differently(entry.configuration, configuration);
+
+        entry.configuration = configuration;
+        entry.is_connected = is_connected;
+
+        if (is_changed)
+        {
+            const auto &model_index = index(it->second);
+            emit dataChanged(model_index, model_index);
+        }
+    }
+}
+
+auto PowerStripListModel::set_enumerating(const bool &is_enumerating) -> void
+{
+    if (m_is_enumerating == is_enumerating)
+    {
+        return;
+    }
+
+    m_is_enumerating = is_enumerating;
+
+    for (size_t row = 0; row < m_entries.size(); ++row)
+    {
+        if (m_entries[row].is_connected)
+        {
+            continue;
+        }
+
+        const auto &model_index = index(int(row));
+        emit dataChanged(model_index, model_index);
+    }
+}
+
+auto PowerStripListModel::configuration(const QModelIndex &index) const
+    -> const sokketter::power_strip_configuration &
+{
+    return m_entries.at(index.row()).configuration;
+}
+
+auto PowerStripListModel::configure(const sokketter::power_strip_configuration &configuration)
+    -> void
+{
+    for (size_t row = 0; row < m_entries.size(); ++row)
+    {
+        if (m_entries[row].configuration.id != configuration.id)
+        {
+            continue;
+        }
+
+        m_entries[row].configuration = configuration;
+
+        const auto &model_index = index(int(row));
+        emit dataChanged(model_index, model_index);
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef POWERSTRIPLISTMODEL_H
+#define POWERSTRIPLISTMODEL_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <QAbstractListModel>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief power strips shown in the device list, painted by ListItemDelegate.
+ */
+class PowerStripListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit PowerStripListModel(QObject *parent = nullptr);
+
+    auto rowCount(const QModelIndex &parent = QModelIndex()) const -> int override;
+    auto data(const QModelIndex &index, int role = Qt::DisplayRole) const -> QVariant override;
+
+    /**
+     * @brief applies the enumerated power strips to the rows by their ids: new ones are added,
+     * vanished ones removed and the others updated in place.
+     */
+    auto set_power_strips(const std::vector<std::shared_ptr<sokketter::power_strip>> &power_strips)
+        -> void;
+
+    /**
+     * @brief shows the disconnected power strips as pending while an enumeration may still find
+     * them.
+     */
+    auto set_enumerating(const bool &is_enumerating) -> void;
+
+    auto configuration(const QModelIndex &index) const
+        -> const sokketter::power_strip_configuration &;
+
+    /**
+     * @brief updates the row of the power strip with the same id, e.g. after authentication.
+     */
+    auto configure(const sokketter::power_strip_configuration &configuration) -> void;
+
+private:
+    struct entry
+    {
+        sokketter::power_strip_configuration configuration;
+        bool is_connected = false;
+    };
+
+    std::vector<entry> m_entries;
+    bool m_is_enumerating = false;
+};
+
+#endif // POWERSTRIPLISTMODEL_H
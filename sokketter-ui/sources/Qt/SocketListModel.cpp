@@ -0,0 +1,185 @@
+#include "SocketListModel.h"
+
+#include <Qt/ListItemDelegate.h>
+
+#include <QLedLabel.h>
+
+#include <algorithm>
+
+SocketListModel::SocketListModel(QObject *parent)
+    : QAbstractListModel(parent)
+{}
+
+auto SocketListModel::rowCount(const QModelIndex &parent) const -> int
+{
+    return parent.isValid() ? 0 : int(m_entries.size());
+}
+
+auto SocketListModel::data(const QModelIndex &index, int role) const -> QVariant
+{
+    if (!index.isValid() || index.row() >= int(m_entries.size()))
+    {
+        return {};
+    }
+
+    const auto &entry = m_entries[index.row()];
+
+    switch (role)
+    {
+    case Qt::DisplayRole: {
+        return "Socket " + QString::number(index.row() + 1);
+    }
+    case Qt::ToolTipRole: {
+        const QString suffix = entry.is_last_known ? tr(" (last known)") : QString();
+
+        switch (entry.state)
+        {
+        case QLedLabel::StateOk: {
+            return tr("powered on") + suffix;
+        }
+        case QLedLabel::StateError: {
+            return tr("powered off") + suffix;
+        }
+        default: {
+            return tr("unknown");
+        }
+        }
+    }
+    case ListItemDelegate::IconRole: {
+        return QStringLiteral("socket_icon");
+    }
+    case ListItemDelegate::TitleSuffixRole: {
+        return ": " + QString::fromStdString(entry.configuration.name);
+    }
+    case ListItemDelegate::DescriptionRole: {
+        return QString::fromStdString(entry.configuration.description);
+    }
+    case ListItemDelegate::StateRole: {
+        return entry.state;
+    }
+    case ListItemDelegate::ResetMsecRole: {
+        return int(entry.configuration.configurable_reset_msec);
+    }
+    case ListItemDelegate::ResetEnabledRole: {
+        return entry.is_reset_enabled;
+    }
+    default: {
+        return {};
+    }
+    }
+}
+
+auto SocketListModel::flags(const QModelIndex &index) const -> Qt::ItemFlags
+{
+    if (!index.isValid() || index.row() >= int(m_entries.size()))
+    {
+        return Qt::NoItemFlags;
+    }
+
+    if (!m_is_connected || m_entries[index.row()].is_busy)
+    {
+        return Qt::NoItemFlags;
+    }
+
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+auto SocketListModel::set_device(const std::shared_ptr<sokketter::power_strip> &device) -> void
+{
+    beginResetModel();
+
+    m_entries.clear();
+    m_is_connected = device != nullptr && device->is_connected();
+
+    if (device != nullptr)
+    {
+        const auto &sockets = device->sockets();
+        const auto &last_known_states = device->last_known_socket_states();
+
+        m_entries.reserve(sockets.size());
+        for (size_t index = 0; index < sockets.size(); ++index)
+        {
+            entry socket_entry{sockets[index].configuration(), QLedLabel::StateUnknown};
+
+            if (index < last_known_states.size() && last_known_states[index].is_valid)
+            {
+                socket_entry.state = last_known_states[index].is_powered_on
+                                         ? QLedLabel::StateOk
+                                         : QLedLabel::StateError;
+                socket_entry.is_last_known = true;
+            }
+
+            m_entries.push_back(socket_entry);
+        }
+    }
+
+    endResetModel();
+}
+
+auto SocketListModel::set_state(const int &row, const bool &is_powered_on) -> void
+{
+    if (row < 0 || row >= int(m_entries.size()))
+    {
+        return;
+    }
+
+    m_entries[row].state = is_powered_on ? QLedLabel::StateOk : QLedLabel::StateError;
+    m_entries[row].is_last_known = false;
+    emit_row_changed(row);
+}
+
+auto SocketListModel::set_states(const std::vector<sokketter::socket_state> &states) -> void
+{
+    const int count = std::min(int(states.size()), int(m_entries.size()));
+    for (int row = 0; row < count; ++row)
+    {
+        if (!states[row].is_valid)
+        {
+            continue;
+        }
+
+        const int state = states[row].is_powered_on ? QLedLabel::StateOk : QLedLabel::StateError;
+        if (m_entries[row].state == state && !m_entries[row].is_last_known)
+        {
+            continue;
+        }
+
+        m_entries[row].state = state;
+        m_entries[row].is_last_known = false;
+        emit_row_changed(row);
+    }
+}
+
+auto SocketListModel::set_busy(const int &row, const bool &is_busy) -> void
+{
+    if (row < 0 || row >= int(m_entries.size()))
+    {
+        return;
+    }
+
+    m_entries[row].is_busy = is_busy;
+    emit_row_changed(row);
+}
+
+auto SocketListModel::set_reset_enabled(const int &row, const bool &is_enabled) -> void
+{
+    if (row < 0 || row >= int(m_entries.size()))
+    {
+        return;
+    }
+
+    m_entries[row].is_reset_enabled = is_enabled;
+    emit_row_changed(row);
+}
+
+auto SocketListModel::socket_configuration(const int &row) const
+    -> const sokketter::socket_configuration &
+{
+    return m_entries.at(row).configuration;
+}
+
+auto SocketListModel::emit_row_changed(const int &row) -> void
+{
+    const auto &model_index = index(row);
+    emit dataChanged(model_index, model_index);
+}
@@ -0,0 +1,69 @@
+#ifndef SOCKETLISTMODEL_H
+#define SOCKETLISTMODEL_H
+
+#pragma once
+
+#include <libsokketter.h>
+
+#include <QAbstractListModel>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief sockets of the selected power strip, painted by ListItemDelegate.
+ */
+class SocketListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit SocketListModel(QObject *parent = nullptr);
+
+    auto rowCount(const QModelIndex &parent = QModelIndex()) const -> int override;
+    auto data(const QModelIndex &index, int role = Qt::DisplayRole) const -> QVariant override;
+    auto flags(const QModelIndex &index) const -> Qt::ItemFlags override;
+
+    /**
+     * @brief shows the sockets of the power strip with their last known states until the
+     * states are read.
+     */
+    auto set_device(const std::shared_ptr<sokketter::power_strip> &device) -> void;
+
+    auto set_state(const int &row, const bool &is_powered_on) -> void;
+
+    /**
+     * @brief applies the read states in socket order, only the rows whose state changed are
+     * repainted and states that could not be read are skipped.
+     */
+    auto set_states(const std::vector<sokketter::socket_state> &states) -> void;
+
+    /**
+     * @brief disables the row while a device operation on its socket is running.
+     */
+    auto set_busy(const int &row, const bool &is_busy) -> void;
+    auto set_reset_enabled(const int &row, const bool &is_enabled) -> void;
+
+    auto socket_configuration(const int &row) const -> const sokketter::socket_configuration &;
+
+private:
+    struct entry
+    {
+        sokketter::socket_configuration configuration;
+        int state = 0;
+        bool is_busy = false;
+        bool is_reset_enabled = true;
+
+        /**
+         * @brief the state was restored from the device database and not read yet.
+         */
+        bool is_last_known = false;
+    };
+
+    std::vector<entry> m_entries;
+    bool m_is_connected = false;
+
+    auto emit_row_changed(const int &row) -> void;
+};
+
+#endif // SOCKETLISTMODEL_H
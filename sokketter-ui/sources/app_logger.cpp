@@ -61,10 +61,16 @@ auto initialize_app_logger() -> void
     APP_LOGGER->set_level(spdlog::level::trace);
     APP_LOGGER->set_pattern("%Y-%m-%d %T.%e - %l - %s:%# - %v");
 
-    sokketter::settings_structure settings;
+    auto settings = sokketter::settings();
 
     settings.logging_level = sokketter::logging_level(APP_LOGGER->level());
-    settings.logging_callback = std::bind(&logging_callback, std::placeholders::_1);
+    settings.logging_view_callback = std::bind(&logging_callback, std::placeholders::_1);
+
+    /**
+     * @attention library messages are written to the log files from the library dispatcher thread,
+     * so slow disk writes do not stall device I/O.
+     */
+    settings.logging_mode = sokketter::logging_mode::ASYNCHRONOUS;
 
     sokketter::set_settings(settings);
 
@@ -87,8 +93,14 @@ auto deinitialize_app_logger() -> void
     spdlog::drop(LOGGER_NAME);
 }
 
-auto logging_callback(const sokketter::callback_response_structure &response) -> void
+auto logging_callback(const sokketter::callback_view_structure &response) -> void
 {
-    APP_LOGGER->log(spdlog::source_loc{response.file, response.line, response.function},
+    const auto logger = APP_LOGGER;
+    if (logger == nullptr)
+    {
+        return;
+    }
+
+    logger->log(spdlog::source_loc{response.file, response.line, response.function},
         spdlog::level::level_enum(response.level), response.message);
 }
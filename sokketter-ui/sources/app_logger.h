@@ -11,6 +11,6 @@ constexpr auto LOGGER_NAME = "sokketter-ui";
 auto initialize_app_logger() -> void;
 auto deinitialize_app_logger() -> void;
 
-auto logging_callback(const sokketter::callback_response_structure &response) -> void;
+auto logging_callback(const sokketter::callback_view_structure &response) -> void;
 
 #endif // APP_LOGGER_H
@@ -17,7 +17,8 @@ void to_json(nlohmann::json &j, const app_settings &s)
 {
     j = nlohmann::json{{"window", s.window}, {"socket_toggle", s.socket_toggle}, {"theme", s.theme},
         {"is_usb_devices_allowed", s.is_usb_devices_allowed},
-        {"is_ethernet_devices_allowed", s.is_ethernet_devices_allowed}};
+        {"is_ethernet_devices_allowed", s.is_ethernet_devices_allowed},
+        {"socket_state_refresh_interval_msec", s.socket_state_refresh_interval_msec}};
 }
 
 void from_json(const nlohmann::json &j, app_settings &s)
@@ -27,4 +28,5 @@ void from_json(const nlohmann::json &j, app_settings &s)
     s.theme = j.value("theme", theme_type::T_AUTO);
     s.is_usb_devices_allowed = j.value("is_usb_devices_allowed", true);
     s.is_ethernet_devices_allowed = j.value("is_ethernet_devices_allowed", false);
+    s.socket_state_refresh_interval_msec = j.value("socket_state_refresh_interval_msec", 5000);
 }
@@ -54,6 +54,11 @@ struct app_settings
 
     bool is_usb_devices_allowed = true;
     bool is_ethernet_devices_allowed = false;
+
+    /**
+     * @brief period of re-reading the shown socket states, 0 disables it.
+     */
+    int socket_state_refresh_interval_msec = 5000;
 };
 
 void to_json(nlohmann::json &j, const app_settings &s);
@@ -4,6 +4,7 @@
 #include <libsokketter.h>
 
 #include <QFileInfo>
+#include <filesystem>
 #include <fstream>
 #include <spdlog/spdlog.h>
 
@@ -22,6 +23,12 @@ auto app_settings_storage::save() const -> void
     SPDLOG_LOGGER_DEBUG(
         APP_LOGGER, "Saving the application settings to '{}' file.", path().string());
 
+    /**
+     * @attention the library creates the storage folder lazily, so it may not exist yet.
+     */
+    std::error_code error_code;
+    std::filesystem::create_directories(path().parent_path(), error_code);
+
     std::ofstream file(path().string());
     if (!file.is_open())
     {
@@ -0,0 +1,75 @@
+#include <device_task_queue.h>
+
+device_task_queue::device_task_queue(const int &max_thread_count)
+{
+    m_pool.setMaxThreadCount(max_thread_count);
+}
+
+device_task_queue::~device_task_queue()
+{
+    clear();
+    wait_for_done();
+}
+
+auto device_task_queue::clear() -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto &[queue_id, queue] : m_queues)
+    {
+        queue.tasks.clear();
+    }
+}
+
+auto device_task_queue::wait_for_done() -> void
+{
+    m_pool.waitForDone();
+}
+
+auto device_task_queue::enqueue(const std::string &queue_id, std::function<void()> task) -> void
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto &queue = m_queues[queue_id];
+    queue.tasks.push_back(std::move(task));
+
+    if (queue.is_running)
+    {
+        return;
+    }
+
+    queue.is_running = true;
+    m_pool.start([this, queue_id]() { run_next(queue_id); });
+}
+
+auto device_task_queue::run_next(const std::string &queue_id) -> void
+{
+    std::function<void()> task;
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto &queue = m_queues[queue_id];
+        if (queue.tasks.empty())
+        {
+            m_queues.erase(queue_id);
+            return;
+        }
+
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+    }
+
+    task();
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto &queue = m_queues[queue_id];
+    if (queue.tasks.empty())
+    {
+        m_queues.erase(queue_id);
+        return;
+    }
+
+    m_pool.start([this, queue_id]() { run_next(queue_id); });
+}
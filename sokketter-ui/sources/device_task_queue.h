@@ -0,0 +1,87 @@
+#ifndef DEVICE_TASK_QUEUE_H
+#define DEVICE_TASK_QUEUE_H
+
+#pragma once
+
+#include <QFuture>
+#include <QPromise>
+#include <QThreadPool>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief runs blocking device operations on a shared thread pool.
+ *
+ * Operations queued for the same device run one at a time in the order they were queued, matching
+ * the device's single-session nature, while operations on different devices run in parallel, so
+ * a power strip that is timing out does not hold up the others.
+ */
+class device_task_queue
+{
+public:
+    explicit device_task_queue(const int &max_thread_count);
+    ~device_task_queue();
+
+    device_task_queue(const device_task_queue &) = delete;
+    auto operator=(const device_task_queue &) -> device_task_queue & = delete;
+
+    /**
+     * @brief queues the work behind the pending operations of the given device.
+     * @param queue_id id of the power strip, or any other name for operations spanning devices.
+     * @return future finished with the result of the work, or cancelled if the work was dropped
+     * by clear().
+     */
+    template <typename result_type>
+    auto run(const std::string &queue_id, std::function<result_type()> work)
+        -> QFuture<result_type>
+    {
+        auto promise = std::make_shared<QPromise<result_type>>();
+        promise->start();
+
+        auto future = promise->future();
+
+        enqueue(queue_id, [promise, work = std::move(work)]() {
+            promise->addResult(work());
+            promise->finish();
+        });
+
+        return future;
+    }
+
+    /**
+     * @brief drops the operations that have not started yet.
+     */
+    auto clear() -> void;
+
+    /**
+     * @brief waits until the running operations complete.
+     */
+    auto wait_for_done() -> void;
+
+private:
+    struct queue
+    {
+        std::deque<std::function<void()>> tasks;
+        bool is_running = false;
+    };
+
+    std::mutex m_mutex;
+    std::map<std::string, queue> m_queues;
+    QThreadPool m_pool;
+
+    auto enqueue(const std::string &queue_id, std::function<void()> task) -> void;
+
+    /**
+     * @brief runs the oldest operation of the queue and hands the next one back to the pool.
+     * @attention handing back after every operation keeps a busy device from occupying a worker
+     * while other devices wait.
+     */
+    auto run_next(const std::string &queue_id) -> void;
+};
+
+#endif // DEVICE_TASK_QUEUE_H
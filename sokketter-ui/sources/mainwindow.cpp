@@ -4,9 +4,7 @@
 
 #include <Qt/DeviceEditForm.h>
 #include <Qt/EmptyPowerStripListItem.h>
-#include <Qt/PowerStripListItem.h>
 #include <Qt/SocketEditForm.h>
-#include <Qt/SocketListItem.h>
 #include <app_logger.h>
 #include <app_settings_storage.h>
 #include <spdlog/sinks/daily_file_sink.h>
@@ -20,6 +18,7 @@
 #include <ClickableLabel.h>
 #include <QApplication>
 #include <QButtonGroup>
+#include <QCursor>
 #include <QDesktopServices>
 #include <QEvent>
 #include <QFileInfo>
@@ -27,28 +26,50 @@
 #include <QLabel>
 #include <QLineEdit>
 #include <QListWidgetItem>
+#include <QMenu>
 #include <QMessageBox>
-#include <QPointer>
 #include <QScrollBar>
 #include <QTimer>
 #include <QUrl>
-#include <QtConcurrent>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
     , m_ui(new Ui::MainWindow)
+    , m_device_queue(DEVICE_THREAD_COUNT)
 {
     initialize_app_logger();
 
+    /**
+     * @attention the device page of an Ethernet power strip opens with the socket states read by
+     * the warm-up instead of waiting for the login. The states are kept past their TTL and read
+     * again in the background, otherwise they would expire long before the page is opened.
+     */
+    auto library_settings = sokketter::settings();
+    library_settings.is_ethernet_warm_up_enabled = true;
+    library_settings.socket_state_cache_mode =
+        sokketter::socket_state_cache_mode::STALE_WHILE_REVALIDATE;
+    sokketter::set_settings(library_settings);
+
     sokketter::initialize();
 
     m_ui->setupUi(this);
 
     /**
-     * @brief a single worker keeps device network I/O off the UI thread and serialized, matching
-     * the device's single-session nature.
+     * @brief the lists paint their rows from models, so no widget is created per row.
      */
-    m_device_pool.setMaxThreadCount(1);
+    m_power_strip_model = new PowerStripListModel(this);
+    m_socket_model = new SocketListModel(this);
+    m_dashboard_model = new DashboardListModel(this);
+    m_list_item_delegate = new ListItemDelegate(this);
+
+    m_ui->power_strip_list_widget->setModel(m_power_strip_model);
+    m_ui->power_strip_list_widget->setItemDelegate(m_list_item_delegate);
+
+    m_ui->socket_list_widget->setModel(m_socket_model);
+    m_ui->socket_list_widget->setItemDelegate(m_list_item_delegate);
+
+    m_ui->dashboard_list_widget->setModel(m_dashboard_model);
+    m_ui->dashboard_list_widget->setItemDelegate(m_list_item_delegate);
 
     app_settings_storage::instance().load();
 
@@ -60,22 +81,64 @@ MainWindow::MainWindow(QWidget *parent)
 
     SPDLOG_LOGGER_DEBUG(APP_LOGGER, "sokketter-ui has started.");
 
+    /**
+     * @brief a refresh still waiting on a slow device is not queued again.
+     */
+    QObject::connect(&m_socket_state_refresh_timer, &QTimer::timeout, this, [this]() {
+        const auto *page = m_ui->stackedWidget->currentWidget();
+
+        if (page == m_ui->socket_list_page && !m_is_socket_state_refresh_pending)
+        {
+            refresh_socket_states_async(true);
+        }
+        else if (page == m_ui->dashboard_page && m_pending_dashboard_reads == 0)
+        {
+            refresh_dashboard_async(true);
+        }
+    });
+
+    QObject::connect(m_ui->stackedWidget, &QStackedWidget::currentChanged, this,
+        [this]() { update_socket_state_refresh_timer(); });
+
     /**
      * @brief connect the signals to the slots.
      */
     QObject::connect(
         this, &MainWindow::newPowerStripReceived, this, &MainWindow::onNewPowerStripReceived);
     QObject::connect(this, &MainWindow::newStatusReceived, this, &MainWindow::onNewStatusReceived);
-    QObject::connect(this, &MainWindow::toggleResetButton, this, &MainWindow::onResetButtonToggled);
 
-    QObject::connect(m_ui->power_strip_list_widget, &QListWidget::itemClicked, this,
+    QObject::connect(m_ui->power_strip_list_widget, &QAbstractItemView::clicked, this,
         &MainWindow::onPowerStripClicked);
 
+    m_ui->power_strip_list_widget->setContextMenuPolicy(Qt::CustomContextMenu);
+    QObject::connect(m_ui->power_strip_list_widget, &QWidget::customContextMenuRequested, this,
+        &MainWindow::onPowerStripListContextMenuRequested);
+
     connect_socket_list_on_click();
 
+    QObject::connect(m_list_item_delegate, &ListItemDelegate::resetRequested, this,
+        &MainWindow::onSocketResetClicked);
+
     QObject::connect(m_ui->power_strip_list_refresh_label, &ClickableLabel::clicked,
         [this]() { repopulate_device_list(); });
 
+    QObject::connect(m_ui->power_strip_dashboard_label, &ClickableLabel::clicked, [this]() {
+        const int &index = m_ui->stackedWidget->indexOf(m_ui->dashboard_page);
+        m_ui->stackedWidget->setCurrentIndex(index);
+
+        repopulate_dashboard();
+    });
+
+    QObject::connect(m_ui->dashboard_refresh_label, &ClickableLabel::clicked,
+        [this]() { repopulate_dashboard(); });
+
+    QObject::connect(m_ui->dashboard_back_label, &ClickableLabel::clicked, [this]() {
+        cancel_dashboard_refresh();
+
+        const int &index = m_ui->stackedWidget->indexOf(m_ui->power_strip_list_page);
+        m_ui->stackedWidget->setCurrentIndex(index);
+    });
+
     QObject::connect(m_ui->power_strip_settings_label, &ClickableLabel::clicked, [this]() {
         const int &index = m_ui->stackedWidget->indexOf(m_ui->settings_page);
         m_ui->stackedWidget->setCurrentIndex(index);
@@ -93,8 +156,6 @@ MainWindow::MainWindow(QWidget *parent)
     QObject::connect(m_ui->authentication_back_label, &ClickableLabel::clicked, [this]() {
         const int &index = m_ui->stackedWidget->indexOf(m_ui->power_strip_list_page);
         m_ui->stackedWidget->setCurrentIndex(index);
-
-        redraw_device_list();
     });
 
     auto size_policy2 = m_ui->authentication_status_label->sizePolicy();
@@ -109,10 +170,10 @@ MainWindow::MainWindow(QWidget *parent)
     });
 
     QObject::connect(m_ui->socket_list_back_label, &ClickableLabel::clicked, [this]() {
+        cancel_socket_state_refresh();
+
         const int &index = m_ui->stackedWidget->indexOf(m_ui->power_strip_list_page);
         m_ui->stackedWidget->setCurrentIndex(index);
-
-        redraw_device_list();
     });
 
     QObject::connect(m_ui->configure_back_label, &ClickableLabel::clicked, [this]() {
@@ -182,13 +243,24 @@ MainWindow::MainWindow(QWidget *parent)
 
     sokketter::check_for_update_async();
 
+    /**
+     * @brief show the power strips stored in the device database right away as pending, the
+     * enumeration started shortly after confirms them in place however long the discovery takes.
+     */
+    m_power_strips = sokketter::known_devices();
+    m_power_strip_model->set_enumerating(true);
+    m_power_strip_model->set_power_strips(m_power_strips);
+
     QTimer::singleShot(25, [this]() { repopulate_device_list(); });
 }
 
 MainWindow::~MainWindow()
 {
-    m_device_pool.clear();
-    m_device_pool.waitForDone();
+    cancel_socket_state_refresh();
+    cancel_dashboard_refresh();
+
+    m_device_queue.clear();
+    m_device_queue.wait_for_done();
 
     if (m_device != nullptr)
     {
@@ -215,57 +287,62 @@ auto MainWindow::closeEvent(QCloseEvent *event) -> void
     QMainWindow::closeEvent(event);
 }
 
-auto MainWindow::onNewPowerStripReceived(
-    std::vector<std::shared_ptr<sokketter::power_strip>> power_strips) -> void
+auto MainWindow::changeEvent(QEvent *event) -> void
 {
-    SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Repopulating power strip list.");
-
-    while (m_ui->power_strip_list_widget->count() > 0)
-    {
-        m_ui->power_strip_list_widget->takeItem(0);
-    }
+    QMainWindow::changeEvent(event);
 
-    int visible_width = m_ui->power_strip_list_widget->width();
-    if (m_ui->power_strip_list_widget->verticalScrollBar()->isVisible())
+    if (event->type() == QEvent::WindowStateChange)
     {
-        visible_width -= (m_ui->power_strip_list_widget->verticalScrollBar()->width() * 2);
+        update_socket_state_refresh_timer();
     }
+}
 
-    int visible_height = m_ui->power_strip_list_widget->height();
-    if (m_ui->power_strip_list_widget->horizontalScrollBar()->isVisible())
-    {
-        visible_height -= (m_ui->power_strip_list_widget->horizontalScrollBar()->height() * 2);
-    }
+auto MainWindow::showEvent(QShowEvent *event) -> void
+{
+    QMainWindow::showEvent(event);
 
-    for (const auto &power_strip : power_strips)
-    {
-        auto *power_strip_item = new PowerStripListItem(power_strip->configuration());
-        power_strip_item->setMaximumWidth(visible_width);
-        power_strip_item->set_state(power_strip->is_connected());
+    update_socket_state_refresh_timer();
+}
 
-        auto *item = new QListWidgetItem();
-        const auto &size_hint = power_strip_item->sizeHint();
-        item->setSizeHint(QSize(std::max(size_hint.width(), visible_width), size_hint.height()));
+auto MainWindow::hideEvent(QHideEvent *event) -> void
+{
+    QMainWindow::hideEvent(event);
 
-        m_ui->power_strip_list_widget->addItem(item);
-        m_ui->power_strip_list_widget->setItemWidget(item, power_strip_item);
-    }
+    update_socket_state_refresh_timer();
+}
 
-    if (power_strips.empty())
-    {
-        auto *empty_item = new EmptyPowerStripListItem();
-        empty_item->setMaximumHeight(visible_height);
-        empty_item->setMaximumWidth(visible_width);
+auto MainWindow::onNewPowerStripReceived(
+    std::vector<std::shared_ptr<sokketter::power_strip>> power_strips) -> void
+{
+    SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Updating power strip list.");
 
-        auto *item = new QListWidgetItem();
-        item->setFlags(Qt::NoItemFlags);
-        item->setSizeHint(QSize(visible_width, visible_height));
+    m_power_strips = power_strips;
+    m_power_strip_model->set_power_strips(power_strips);
 
-        m_ui->power_strip_list_widget->addItem(item);
-        m_ui->power_strip_list_widget->setItemWidget(item, empty_item);
+    /**
+     * @attention the placeholder is set once the enumeration reports, so it does not show while
+     * the first enumeration is still running.
+     */
+    if (m_ui->power_strip_list_widget->placeholder() == nullptr)
+    {
+        m_ui->power_strip_list_widget->set_placeholder(new EmptyPowerStripListItem());
     }
 
-    redraw_device_list();
+    /**
+     * @attention a power strip opened while it was still pending gets its sockets enabled once the
+     * enumeration confirms it.
+     */
+    if (m_device != nullptr && m_device->is_connected() &&
+        m_ui->stackedWidget->currentWidget() == m_ui->socket_list_page &&
+        !m_ui->socket_list_widget->isEnabled())
+    {
+        const auto &authentication = m_device->configuration().authentication;
+        if (authentication.type == sokketter::power_strip_authentication_type::NONE ||
+            authentication.is_valid())
+        {
+            repopulate_socket_list();
+        }
+    }
 }
 
 auto MainWindow::onNewStatusReceived(sokketter::enumeration_status status) -> void
@@ -285,6 +362,7 @@ auto MainWindow::onNewStatusReceived(sokketter::enumeration_status status) -> vo
     case sokketter::enumeration_status::UNKNOWN:
     case sokketter::enumeration_status::COMPLETED: {
         m_ui->power_strip_enumeration_status_label->clear();
+        m_power_strip_model->set_enumerating(false);
         break;
     }
     }
@@ -311,118 +389,34 @@ auto MainWindow::repopulate_device_list() -> void
             static_cast<int>(sokketter::power_strip_type::ETHERNET_DEVICES));
     }
 
+    m_power_strip_model->set_enumerating(true);
+
     sokketter::devices(filter,
         std::bind(&MainWindow::new_devices_received, this, std::placeholders::_1),
         std::bind(&MainWindow::new_status_received, this, std::placeholders::_1));
 }
 
-auto MainWindow::redraw_device_list() -> void
-{
-    if (m_ui->power_strip_list_widget->isVisible())
-    {
-        SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Re-drawing power strip list.");
-
-        int visible_width = m_ui->power_strip_list_widget->width();
-        if (m_ui->power_strip_list_widget->verticalScrollBar()->isVisible())
-        {
-            visible_width -= (m_ui->power_strip_list_widget->verticalScrollBar()->width() * 2);
-        }
-
-        int visible_height = m_ui->power_strip_list_widget->height();
-        if (m_ui->power_strip_list_widget->horizontalScrollBar()->isVisible())
-        {
-            visible_height -= (m_ui->power_strip_list_widget->horizontalScrollBar()->height() * 2);
-        }
-
-        const int &item_count = m_ui->power_strip_list_widget->count();
-        for (int item_index = 0; item_index < item_count; ++item_index)
-        {
-            auto *list_widget = m_ui->power_strip_list_widget->item(item_index);
-            if (list_widget == nullptr)
-            {
-                SPDLOG_LOGGER_ERROR(
-                    APP_LOGGER, "Failed getting list widget item from the device list!");
-                continue;
-            }
-
-            auto *widget = m_ui->power_strip_list_widget->itemWidget(list_widget);
-            if (widget == nullptr)
-            {
-                SPDLOG_LOGGER_ERROR(
-                    APP_LOGGER, "Failed getting display widget item from the device list!");
-                continue;
-            }
-
-            if (qobject_cast<EmptyPowerStripListItem *>(widget))
-            {
-                widget->setMaximumWidth(visible_width);
-                widget->setMaximumHeight(visible_height);
-
-                const auto &size_hint = widget->sizeHint();
-                list_widget->setSizeHint(QSize(std::max(size_hint.width(), visible_width),
-                    std::max(size_hint.height(), visible_height)));
-            }
-            else if (qobject_cast<PowerStripListItem *>(widget))
-            {
-                widget->setMaximumWidth(visible_width);
-
-                const auto &size_hint = widget->sizeHint();
-                list_widget->setSizeHint(
-                    QSize(std::max(size_hint.width(), visible_width), size_hint.height()));
-            }
-        }
-    }
-}
-
 auto MainWindow::repopulate_socket_list() -> void
 {
     SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Repopulating socket list.");
 
-    while (m_ui->socket_list_widget->count() > 0)
-    {
-        m_ui->socket_list_widget->takeItem(0);
-    }
-
     const auto &device_configuration = m_device->configuration();
 
     m_ui->socket_list_device_label->setText(
         "of " + QString::fromStdString(device_configuration.name));
 
-    const auto &sockets = m_device->sockets();
     const bool is_connected = m_device->is_connected();
-    for (size_t socket_index = 0; socket_index < sockets.size(); socket_index++)
-    {
-        const auto &socket = sockets[socket_index];
-
-        auto *socket_item =
-            new SocketListItem(device_configuration, socket.configuration(), socket_index);
-        socket_item->setEnabled(is_connected);
-        if (is_connected)
-        {
-            QObject::connect(socket_item, &SocketListItem::configurableResetRequested, this,
-                &MainWindow::onSocketResetClicked);
-        }
-
-        const auto &size_hint = socket_item->sizeHint();
-
-        auto *item = new QListWidgetItem();
-        item->setSizeHint(QSize(size_hint.width(), size_hint.height()));
-
-        m_ui->socket_list_widget->addItem(item);
-        m_ui->socket_list_widget->setItemWidget(item, socket_item);
-    }
 
+    m_socket_model->set_device(m_device);
     m_ui->socket_list_widget->setEnabled(is_connected);
 
-    redraw_socket_list();
-
     if (is_connected)
     {
         refresh_socket_states_async();
     }
 }
 
-auto MainWindow::refresh_socket_states_async() -> void
+auto MainWindow::refresh_socket_states_async(const bool &is_cache_bypassed) -> void
 {
     auto device = m_device;
     if (device == nullptr)
@@ -430,102 +424,199 @@ auto MainWindow::refresh_socket_states_async() -> void
         return;
     }
 
-    auto *watcher = new QFutureWatcher<std::vector<bool>>(this);
+    m_is_socket_state_refresh_pending = true;
+
+    using socket_states = std::vector<sokketter::socket_state>;
+
+    auto *watcher = new QFutureWatcher<socket_states>(this);
     QObject::connect(
-        watcher, &QFutureWatcher<std::vector<bool>>::finished, this, [this, watcher, device]() {
-            const std::vector<bool> states = watcher->result();
+        watcher, &QFutureWatcher<socket_states>::finished, this, [this, watcher, device]() {
             watcher->deleteLater();
 
-            if (m_device != device)
+            m_is_socket_state_refresh_pending = false;
+
+            if (watcher->isCanceled() || m_device != device)
             {
                 return;
             }
 
-            const int item_count = m_ui->socket_list_widget->count();
-            for (int item_index = 0; item_index < item_count && item_index < int(states.size());
-                ++item_index)
-            {
-                auto *list_widget = m_ui->socket_list_widget->item(item_index);
-                if (list_widget == nullptr)
-                {
-                    continue;
-                }
+            m_socket_model->set_states(watcher->result());
+        });
 
-                auto *socket_item = qobject_cast<SocketListItem *>(
-                    m_ui->socket_list_widget->itemWidget(list_widget));
-                if (socket_item == nullptr)
-                {
-                    continue;
-                }
+    sokketter::call_options options;
+    options.cancellation = m_device_page_cancellation;
 
-                socket_item->set_state(states[item_index]);
-            }
-        });
+    const auto &queue_id = device->configuration().id;
+    watcher->setFuture(
+        m_device_queue.run<socket_states>(queue_id, [device, options, is_cache_bypassed]() {
+            return read_socket_states(device, options, is_cache_bypassed);
+        }));
+}
 
-    watcher->setFuture(QtConcurrent::run(&m_device_pool, [device]() {
-        std::vector<bool> states;
-        const auto &sockets = device->sockets();
-        states.reserve(sockets.size());
-        for (const auto &socket : sockets)
+auto MainWindow::cancel_socket_state_refresh() -> void
+{
+    m_device_page_cancellation.cancel();
+    m_device_page_cancellation = sokketter::cancellation_token();
+}
+
+auto MainWindow::repopulate_dashboard() -> void
+{
+    SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Repopulating dashboard.");
+
+    cancel_dashboard_refresh();
+
+    m_dashboard_model->set_power_strips(m_power_strips);
+
+    refresh_dashboard_async();
+}
+
+auto MainWindow::refresh_dashboard_async(const bool &is_cache_bypassed) -> void
+{
+    using socket_states = std::vector<sokketter::socket_state>;
+
+    sokketter::call_options options;
+    options.cancellation = m_dashboard_cancellation;
+
+    /**
+     * @attention every power strip has its own device queue, so the reads run in parallel and
+     * the dashboard is complete after the slowest power strip answered.
+     */
+    for (const auto &device : m_power_strips)
+    {
+        if (!device->is_connected())
         {
-            states.push_back(socket.is_powered_on());
+            continue;
         }
-        return states;
-    }));
+
+        const auto &device_id = device->configuration().id;
+
+        auto *watcher = new QFutureWatcher<socket_states>(this);
+        QObject::connect(
+            watcher, &QFutureWatcher<socket_states>::finished, this, [this, watcher, device_id]() {
+                watcher->deleteLater();
+
+                --m_pending_dashboard_reads;
+
+                if (watcher->isCanceled())
+                {
+                    return;
+                }
+
+                m_dashboard_model->set_states(device_id, watcher->result());
+            });
+
+        ++m_pending_dashboard_reads;
+
+        watcher->setFuture(
+            m_device_queue.run<socket_states>(device_id, [device, options, is_cache_bypassed]() {
+                return read_socket_states(device, options, is_cache_bypassed);
+            }));
+    }
 }
 
-auto MainWindow::run_device_task(std::function<bool()> work, std::function<void(bool)> on_done)
-    -> void
+auto MainWindow::cancel_dashboard_refresh() -> void
+{
+    m_dashboard_cancellation.cancel();
+    m_dashboard_cancellation = sokketter::cancellation_token();
+}
+
+auto MainWindow::read_socket_states(const std::shared_ptr<sokketter::power_strip> &device,
+    const sokketter::call_options &options, const bool &is_cache_bypassed)
+    -> std::vector<sokketter::socket_state>
+{
+    const sokketter::call_scope scope(options);
+
+    if (is_cache_bypassed)
+    {
+        device->invalidate_socket_states();
+    }
+
+    std::vector<sokketter::socket_state> states;
+    const auto &sockets = device->sockets();
+    states.reserve(sockets.size());
+    for (const auto &socket : sockets)
+    {
+        states.push_back(socket.state());
+    }
+    return states;
+}
+
+auto MainWindow::update_socket_state_refresh_timer() -> void
+{
+    const int interval_msec =
+        app_settings_storage::instance().get().socket_state_refresh_interval_msec;
+
+    const auto *page = m_ui->stackedWidget->currentWidget();
+    const bool is_states_page_shown = (page == m_ui->socket_list_page && m_device != nullptr) ||
+                                      page == m_ui->dashboard_page;
+    const bool is_window_shown = isVisible() && !isMinimized();
+
+    if (interval_msec <= 0 || !is_states_page_shown || !is_window_shown)
+    {
+        m_socket_state_refresh_timer.stop();
+        return;
+    }
+
+    if (!m_socket_state_refresh_timer.isActive())
+    {
+        SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Refreshing socket states every {} ms.", interval_msec);
+        m_socket_state_refresh_timer.start(interval_msec);
+    }
+}
+
+auto MainWindow::run_device_task(const std::string &queue_id, std::function<bool()> work,
+    std::function<void(bool)> on_done) -> void
 {
     auto *watcher = new QFutureWatcher<bool>(this);
     QObject::connect(
         watcher, &QFutureWatcher<bool>::finished, this, [watcher, on_done = std::move(on_done)]() {
-            const bool result = watcher->result();
             watcher->deleteLater();
-            on_done(result);
+
+            if (watcher->isCanceled())
+            {
+                return;
+            }
+
+            on_done(watcher->result());
         });
 
-    watcher->setFuture(QtConcurrent::run(&m_device_pool, std::move(work)));
+    watcher->setFuture(m_device_queue.run<bool>(queue_id, std::move(work)));
 }
 
-auto MainWindow::redraw_socket_list() -> void
+auto MainWindow::run_reconciliation_task(
+    const QString &title, std::function<std::vector<sokketter::socket_reconciliation>()> work)
+    -> void
 {
-    if (m_ui->socket_list_widget->isVisible())
-    {
-        SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Re-drawing socket list.");
-
-        int visible_width = m_ui->socket_list_widget->width();
-        if (m_ui->socket_list_widget->verticalScrollBar()->isVisible())
-        {
-            visible_width -= (m_ui->socket_list_widget->verticalScrollBar()->width() * 2);
-        }
+    auto failed_sockets = std::make_shared<QStringList>();
 
-        const int &item_count = m_ui->socket_list_widget->count();
-        for (int item_index = 0; item_index < item_count; ++item_index)
-        {
-            auto *list_widget = m_ui->socket_list_widget->item(item_index);
-            if (list_widget == nullptr)
+    run_device_task(
+        RECONCILIATION_QUEUE_ID,
+        [work = std::move(work), failed_sockets]() {
+            for (const auto &entry : work())
             {
-                SPDLOG_LOGGER_ERROR(
-                    APP_LOGGER, "Failed getting list widget item from the socket list!");
-                continue;
+                if (entry.result != sokketter::reconciliation_result::UNCHANGED &&
+                    entry.result != sokketter::reconciliation_result::SWITCHED)
+                {
+                    failed_sockets->append(QString::fromStdString(entry.device_id) + " socket " +
+                                           QString::number(entry.socket_index + 1));
+                }
             }
 
-            auto *widget = m_ui->socket_list_widget->itemWidget(list_widget);
-            if (widget == nullptr)
+            return failed_sockets->isEmpty();
+        },
+        [this, title, failed_sockets](bool is_successful) {
+            if (is_successful)
             {
-                SPDLOG_LOGGER_ERROR(
-                    APP_LOGGER, "Failed getting display widget item from the socket list!");
-                continue;
+                return;
             }
 
-            widget->setMaximumWidth(visible_width);
+            SPDLOG_LOGGER_ERROR(APP_LOGGER, "{}: {} socket(s) did not reach their states.",
+                title.toStdString(), failed_sockets->size());
 
-            const auto &size_hint = widget->sizeHint();
-            list_widget->setSizeHint(
-                QSize(std::max(size_hint.width(), visible_width), size_hint.height()));
-        }
-    }
+            QMessageBox::warning(this, title,
+                "The following sockets did not reach their states:\n" +
+                    failed_sockets->join("\n"));
+        });
 }
 
 auto MainWindow::repopulate_configure_list() -> void
@@ -681,7 +772,7 @@ auto MainWindow::forget_selected_device() -> void
     sokketter::forget_device(m_device);
 }
 
-auto MainWindow::populate_authentication_page(PowerStripListItem *item) -> void
+auto MainWindow::populate_authentication_page() -> void
 {
     if (m_device == nullptr)
     {
@@ -706,7 +797,7 @@ auto MainWindow::populate_authentication_page(PowerStripListItem *item) -> void
     }
     }
 
-    auto authenticate = [this, item]() {
+    auto authenticate = [this]() {
         m_ui->authentication_status_label->show();
         m_ui->authentication_status_label->setText("Authenticating...");
 
@@ -728,11 +819,12 @@ auto MainWindow::populate_authentication_page(PowerStripListItem *item) -> void
         auto device = m_device;
 
         /**
-         * @brief authentication is blocking device I/O, so it runs on the worker pool to keep
+         * @brief authentication is blocking device I/O, so it runs on the device queue to keep
          * the UI responsive.
          */
         run_device_task(
-            [device, _configuration, item]() -> bool {
+            _configuration.id,
+            [device, _configuration]() -> bool {
                 device->configure(_configuration);
 
                 if (!device->try_authenticate())
@@ -745,14 +837,17 @@ auto MainWindow::populate_authentication_page(PowerStripListItem *item) -> void
                  */
                 device->save();
 
-                /**
-                 * Inject new configuration into existing power strip list item.
-                 */
-                item->configure(_configuration);
-
                 return true;
             },
-            [this, device](bool success) {
+            [this, device, _configuration](bool success) {
+                if (success)
+                {
+                    /**
+                     * Inject new configuration into existing power strip list row.
+                     */
+                    m_power_strip_model->configure(_configuration);
+                }
+
                 if (m_device != device)
                 {
                     return;
@@ -838,8 +933,6 @@ auto MainWindow::initialize_settings_page() -> void
     QObject::connect(m_ui->settings_back_label, &ClickableLabel::clicked, [this]() {
         const int &index = m_ui->stackedWidget->indexOf(m_ui->power_strip_list_page);
         m_ui->stackedWidget->setCurrentIndex(index);
-
-        redraw_device_list();
     });
 
     auto socket_toggle_lambda = [&](bool checked) {
@@ -942,8 +1035,6 @@ auto MainWindow::initialize_about_page() -> void
     QObject::connect(m_ui->about_back_label, &ClickableLabel::clicked, [this]() {
         const int &index = m_ui->stackedWidget->indexOf(m_ui->power_strip_list_page);
         m_ui->stackedWidget->setCurrentIndex(index);
-
-        redraw_device_list();
     });
 
     QObject::connect(m_ui->about_license_label, &ClickableLabel::clicked, [this]() {
@@ -988,21 +1079,21 @@ auto MainWindow::initialize_about_page() -> void
 
 auto MainWindow::connect_socket_list_on_click() -> void
 {
-    QObject::disconnect(m_ui->socket_list_widget, &QListWidget::itemClicked, nullptr, nullptr);
+    QObject::disconnect(m_ui->socket_list_widget, &QAbstractItemView::clicked, nullptr, nullptr);
     QObject::disconnect(
-        m_ui->socket_list_widget, &QListWidget::itemDoubleClicked, nullptr, nullptr);
+        m_ui->socket_list_widget, &QAbstractItemView::doubleClicked, nullptr, nullptr);
 
     auto &settings = app_settings_storage::instance().get();
     if (settings.socket_toggle == socket_toggle_type::ST_SINGLE_CLICK)
     {
         SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Using single-click for socket activation.");
-        QObject::connect(m_ui->socket_list_widget, &QListWidget::itemClicked, this,
+        QObject::connect(m_ui->socket_list_widget, &QAbstractItemView::clicked, this,
             &MainWindow::onSocketClicked);
     }
     else if (settings.socket_toggle == socket_toggle_type::ST_DOUBLE_CLICK)
     {
         SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Using double-click for socket activation.");
-        QObject::connect(m_ui->socket_list_widget, &QListWidget::itemDoubleClicked, this,
+        QObject::connect(m_ui->socket_list_widget, &QAbstractItemView::doubleClicked, this,
             &MainWindow::onSocketClicked);
     }
     else
@@ -1010,33 +1101,74 @@ auto MainWindow::connect_socket_list_on_click() -> void
         SPDLOG_LOGGER_WARN(APP_LOGGER,
             "Unsupported socket activation type provided {}, defaulting to single-click.",
             int(settings.socket_toggle));
-        QObject::connect(m_ui->socket_list_widget, &QListWidget::itemClicked, this,
+        QObject::connect(m_ui->socket_list_widget, &QAbstractItemView::clicked, this,
             &MainWindow::onSocketClicked);
     }
 }
 
-auto MainWindow::onPowerStripClicked(QListWidgetItem *item) -> void
+auto MainWindow::onPowerStripListContextMenuRequested(const QPoint &position) -> void
+{
+    const auto &groups = sokketter::groups();
+    const auto &scenes = sokketter::scenes();
+    if (groups.empty() && scenes.empty())
+    {
+        return;
+    }
+
+    QMenu menu(this);
+
+    for (const auto &group : groups)
+    {
+        const auto &name = QString::fromStdString(group.name);
+        auto *group_menu = menu.addMenu(name);
+
+        for (const bool is_on : {true, false})
+        {
+            group_menu->addAction(is_on ? "Turn on" : "Turn off", this, [this, name, is_on]() {
+                run_reconciliation_task(name, [devices = m_power_strips, name, is_on]() {
+                    return sokketter::power_group(devices, name.toStdString(), is_on);
+                });
+            });
+        }
+    }
+
+    if (!groups.empty() && !scenes.empty())
+    {
+        menu.addSeparator();
+    }
+
+    for (const auto &scene : scenes)
+    {
+        const auto &name = QString::fromStdString(scene.name);
+        menu.addAction("Apply " + name, this, [this, name]() {
+            run_reconciliation_task(name, [devices = m_power_strips, name]() {
+                return sokketter::apply_scene(devices, name.toStdString());
+            });
+        });
+    }
+
+    menu.exec(m_ui->power_strip_list_widget->viewport()->mapToGlobal(position));
+}
+
+auto MainWindow::onPowerStripClicked(const QModelIndex &index) -> void
 {
     SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Detected onPowerStripClicked() signal.");
 
-    /**
-     * @brief ignore click if it's an EmptyPowerStripListItem.
-     */
-    QWidget *widget = m_ui->power_strip_list_widget->itemWidget(item);
-    if (qobject_cast<EmptyPowerStripListItem *>(widget))
+    if (!index.isValid())
     {
-        SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Ignoring click on empty power strip item.");
+        SPDLOG_LOGGER_ERROR(APP_LOGGER, "Failed getting a power strip from the UI list!");
         return;
     }
 
     if (m_device != nullptr)
     {
+        cancel_socket_state_refresh();
+
         m_device.reset();
         m_device = nullptr;
     }
 
-    auto *list_item = dynamic_cast<PowerStripListItem *>(widget);
-    const auto &configuration = list_item->configuration();
+    const auto configuration = m_power_strip_model->configuration(index);
 
     m_device = sokketter::device(configuration.id);
     if (m_device == nullptr)
@@ -1057,18 +1189,21 @@ auto MainWindow::onPowerStripClicked(QListWidgetItem *item) -> void
             "Device requires authentication but no authentication parameters were "
             "provided or are incorrect. Redirecting to authentication page.");
 
-        populate_authentication_page(list_item);
+        populate_authentication_page();
 
         const int &index = m_ui->stackedWidget->indexOf(m_ui->device_authentication_page);
         m_ui->stackedWidget->setCurrentIndex(index);
     }
     else
     {
+        auto device = m_device;
+
         run_device_task(
-            [this]() -> bool {
-                if (m_device->is_connected())
+            configuration.id,
+            [device]() -> bool {
+                if (device->is_connected())
                 {
-                    return m_device->try_authenticate();
+                    return device->try_authenticate();
                 }
 
                 /**
@@ -1079,7 +1214,15 @@ auto MainWindow::onPowerStripClicked(QListWidgetItem *item) -> void
                  */
                 return true;
             },
-            [this, list_item](bool state) {
+            [this, device](bool state) {
+                /**
+                 * Another power strip was opened while this one was still answering.
+                 */
+                if (m_device != device)
+                {
+                    return;
+                }
+
                 if (state)
                 {
                     const int &index = m_ui->stackedWidget->indexOf(m_ui->socket_list_page);
@@ -1096,7 +1239,7 @@ auto MainWindow::onPowerStripClicked(QListWidgetItem *item) -> void
                     SPDLOG_LOGGER_DEBUG(APP_LOGGER,
                         "Device authentication failed. Redirecting to authentication page.");
 
-                    populate_authentication_page(list_item);
+                    populate_authentication_page();
 
                     const int &index =
                         m_ui->stackedWidget->indexOf(m_ui->device_authentication_page);
@@ -1106,32 +1249,42 @@ auto MainWindow::onPowerStripClicked(QListWidgetItem *item) -> void
     }
 }
 
-auto MainWindow::onSocketClicked(QListWidgetItem *item) -> void
+auto MainWindow::onSocketClicked(const QModelIndex &index) -> void
 {
     SPDLOG_LOGGER_DEBUG(APP_LOGGER, "Detected onSocketClicked() signal.");
 
-    auto socket_item = dynamic_cast<SocketListItem *>(m_ui->socket_list_widget->itemWidget(item));
-    if (socket_item == nullptr)
+    if (!index.isValid())
     {
         SPDLOG_LOGGER_ERROR(APP_LOGGER, "Failed getting a socket from the UI list!");
         return;
     }
 
+    /**
+     * @attention the view reports clicks on the painted reset button too, those are handled by
+     * onSocketResetClicked().
+     */
+    auto *view = m_ui->socket_list_widget;
+    const auto &position = view->viewport()->mapFromGlobal(QCursor::pos());
+    if (m_list_item_delegate->is_reset_button_hit(index, view->visualRect(index), position))
+    {
+        return;
+    }
+
     if (m_device == nullptr)
     {
         SPDLOG_LOGGER_ERROR(APP_LOGGER, "No currently saved device pointer is present!");
         return;
     }
 
-    const size_t index = m_ui->socket_list_widget->row(item);
+    const int row = index.row();
 
     auto device = m_device;
-    QPointer<SocketListItem> guard(socket_item);
-    socket_item->setEnabled(false);
+    m_socket_model->set_busy(row, true);
 
     run_device_task(
-        [device, index]() -> bool {
-            const auto socket_opt = device->socket(index);
+        device->configuration().id,
+        [device, row]() -> bool {
+            const auto socket_opt = device->socket(row);
             if (!socket_opt.has_value())
             {
                 SPDLOG_LOGGER_ERROR(APP_LOGGER, "Failed getting a socket from device!");
@@ -1146,38 +1299,34 @@ auto MainWindow::onSocketClicked(QListWidgetItem *item) -> void
 
             return socket.is_powered_on();
         },
-        [this, guard, device](bool state) {
-            if (guard == nullptr)
+        [this, device, row](bool state) {
+            if (m_device != device)
             {
                 return;
             }
 
-            if (m_device == device)
-            {
-                guard->set_state(state);
-            }
-
-            guard->setEnabled(true);
+            m_socket_model->set_state(row, state);
+            m_socket_model->set_busy(row, false);
         });
 }
 
-auto MainWindow::onSocketResetClicked(SocketListItem *item) -> void
+auto MainWindow::onSocketResetClicked(const QModelIndex &index) -> void
 {
-    emit toggleResetButton(item, false);
-
     if (m_device == nullptr)
     {
         SPDLOG_LOGGER_ERROR(APP_LOGGER, "No currently saved device pointer is present!");
         return;
     }
 
-    const size_t socket_index = item->socket_index();
-    const auto reset_msec = item->socket_configuration().configurable_reset_msec;
+    const int socket_index = index.row();
+    const auto reset_msec =
+        m_socket_model->socket_configuration(socket_index).configurable_reset_msec;
 
     auto device = m_device;
-    QPointer<SocketListItem> guard(item);
+    m_socket_model->set_reset_enabled(socket_index, false);
 
     run_device_task(
+        device->configuration().id,
         [device, socket_index]() -> bool {
             const auto socket_opt = device->socket(socket_index);
             if (!socket_opt.has_value())
@@ -1190,14 +1339,15 @@ auto MainWindow::onSocketResetClicked(SocketListItem *item) -> void
             socket.power(false);
             return socket.is_powered_on();
         },
-        [this, guard, device, socket_index, reset_msec](bool state) {
-            if (guard != nullptr && m_device == device)
+        [this, device, socket_index, reset_msec](bool state) {
+            if (m_device == device)
             {
-                guard->set_state(state);
+                m_socket_model->set_state(socket_index, state);
             }
 
-            QTimer::singleShot(reset_msec, this, [this, guard, device, socket_index]() {
+            QTimer::singleShot(reset_msec, this, [this, device, socket_index]() {
                 run_device_task(
+                    device->configuration().id,
                     [device, socket_index]() -> bool {
                         const auto socket_opt = device->socket(socket_index);
                         if (!socket_opt.has_value())
@@ -1209,26 +1359,19 @@ auto MainWindow::onSocketResetClicked(SocketListItem *item) -> void
                         socket.power(true);
                         return socket.is_powered_on();
                     },
-                    [this, guard, device](bool restored_state) {
-                        if (guard != nullptr && m_device == device)
+                    [this, device, socket_index](bool restored_state) {
+                        if (m_device != device)
                         {
-                            guard->set_state(restored_state);
+                            return;
                         }
 
-                        if (guard != nullptr)
-                        {
-                            emit toggleResetButton(guard, true);
-                        }
+                        m_socket_model->set_state(socket_index, restored_state);
+                        m_socket_model->set_reset_enabled(socket_index, true);
                     });
             });
         });
 }
 
-auto MainWindow::onResetButtonToggled(SocketListItem *item, bool is_on) -> void
-{
-    item->toggle_reset_button_state(is_on);
-}
-
 auto MainWindow::new_devices_received(
     std::vector<std::shared_ptr<sokketter::power_strip>> power_strips) -> void
 {
@@ -1259,8 +1402,6 @@ auto MainWindow::resizeEvent(QResizeEvent *event) -> void
 
     QMainWindow::resizeEvent(event);
 
-    redraw_device_list();
-    redraw_socket_list();
     redraw_configure_list();
 }
 
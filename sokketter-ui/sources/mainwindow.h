@@ -3,13 +3,16 @@
 
 #pragma once
 
-#include <Qt/PowerStripListItem.h>
-#include <SocketListItem.h>
+#include <Qt/DashboardListModel.h>
+#include <Qt/ListItemDelegate.h>
+#include <Qt/PowerStripListModel.h>
+#include <Qt/SocketListModel.h>
+#include <device_task_queue.h>
 #include <libsokketter.h>
 
-#include <QListWidget>
 #include <QMainWindow>
-#include <QThreadPool>
+#include <QModelIndex>
+#include <QTimer>
 
 #include <functional>
 
@@ -31,56 +34,132 @@ signals:
     auto newPowerStripReceived(std::vector<std::shared_ptr<sokketter::power_strip>> power_strips)
         -> void;
     auto newStatusReceived(sokketter::enumeration_status status) -> void;
-    auto toggleResetButton(SocketListItem *object, bool is_on) -> void;
 
 protected:
     auto closeEvent(QCloseEvent *event) -> void override;
+    auto changeEvent(QEvent *event) -> void override;
+    auto showEvent(QShowEvent *event) -> void override;
+    auto hideEvent(QHideEvent *event) -> void override;
 
 private slots:
     auto onNewPowerStripReceived(std::vector<std::shared_ptr<sokketter::power_strip>> power_strips)
         -> void;
     auto onNewStatusReceived(sokketter::enumeration_status status) -> void;
-    auto onPowerStripClicked(QListWidgetItem *item) -> void;
-    auto onSocketClicked(QListWidgetItem *item) -> void;
-    auto onSocketResetClicked(SocketListItem *item) -> void;
-    auto onResetButtonToggled(SocketListItem *item, bool is_on) -> void;
+    auto onPowerStripClicked(const QModelIndex &index) -> void;
+    auto onSocketClicked(const QModelIndex &index) -> void;
+    auto onSocketResetClicked(const QModelIndex &index) -> void;
+    auto onPowerStripListContextMenuRequested(const QPoint &position) -> void;
 
 private:
     Ui::MainWindow *m_ui;
     std::shared_ptr<sokketter::power_strip> m_device = nullptr;
 
     /**
-     * @brief serializes blocking device I/O onto a single worker thread so the UI stays responsive.
+     * @brief power strips shown in the list, groups and scenes are executed on them.
      */
-    QThreadPool m_device_pool;
+    std::vector<std::shared_ptr<sokketter::power_strip>> m_power_strips;
+
+    /**
+     * @brief rows of the power strip, socket and dashboard lists, painted by the shared delegate.
+     */
+    PowerStripListModel *m_power_strip_model = nullptr;
+    SocketListModel *m_socket_model = nullptr;
+    DashboardListModel *m_dashboard_model = nullptr;
+    ListItemDelegate *m_list_item_delegate = nullptr;
+
+    /**
+     * @brief number of power strips served in parallel, they mostly wait on the network.
+     * @attention pool threads are only started on demand and expire when idle.
+     */
+    inline static constexpr int DEVICE_THREAD_COUNT = 64;
+
+    /**
+     * @brief queue of the group and scene executions, which span several power strips.
+     */
+    inline static constexpr auto RECONCILIATION_QUEUE_ID = "reconciliation";
+
+    /**
+     * @brief keeps blocking device I/O off the UI thread, serialized per power strip.
+     */
+    device_task_queue m_device_queue;
+
+    /**
+     * @brief cancels the status reads of the shown device once its page is left.
+     */
+    sokketter::cancellation_token m_device_page_cancellation;
+
+    /**
+     * @brief cancels the status reads of the dashboard once it is left.
+     */
+    sokketter::cancellation_token m_dashboard_cancellation;
+
+    /**
+     * @brief periodically re-reads the socket states of the socket list or the dashboard, see
+     * app_settings::socket_state_refresh_interval_msec.
+     */
+    QTimer m_socket_state_refresh_timer;
+    bool m_is_socket_state_refresh_pending = false;
+    int m_pending_dashboard_reads = 0;
 
     auto new_devices_received(std::vector<std::shared_ptr<sokketter::power_strip>> power_strips)
         -> void;
     auto new_status_received(sokketter::enumeration_status status) -> void;
 
     /**
-     * @brief runs a blocking device operation on the worker thread and delivers the resulting
-     * socket state back on the UI thread.
+     * @brief runs a blocking device operation behind the pending operations of the same power strip
+     * and delivers the resulting socket state back on the UI thread.
      */
-    auto run_device_task(std::function<bool()> work, std::function<void(bool)> on_done) -> void;
+    auto run_device_task(const std::string &queue_id, std::function<bool()> work,
+        std::function<void(bool)> on_done) -> void;
 
     /**
      * @brief reads all socket states of the current device in the background and updates the list.
+     * @param is_cache_bypassed drops the socket states kept by the library before reading.
      */
-    auto refresh_socket_states_async() -> void;
+    auto refresh_socket_states_async(const bool &is_cache_bypassed = false) -> void;
+    auto cancel_socket_state_refresh() -> void;
 
-    auto repopulate_device_list() -> void;
-    auto redraw_device_list() -> void;
+    /**
+     * @brief lists the sockets of all connected power strips and reads their states.
+     */
+    auto repopulate_dashboard() -> void;
+
+    /**
+     * @brief reads the socket states of all power strips on the dashboard in parallel, the rows
+     * of each power strip are updated as soon as it answers.
+     */
+    auto refresh_dashboard_async(const bool &is_cache_bypassed = false) -> void;
+    auto cancel_dashboard_refresh() -> void;
+
+    /**
+     * @brief reads all socket states of the power strip within the limits of the call options.
+     */
+    static auto read_socket_states(const std::shared_ptr<sokketter::power_strip> &device,
+        const sokketter::call_options &options, const bool &is_cache_bypassed)
+        -> std::vector<sokketter::socket_state>;
+
+    /**
+     * @brief runs the periodic refresh only while the socket list or the dashboard is shown in a
+     * visible window.
+     */
+    auto update_socket_state_refresh_timer() -> void;
 
+    /**
+     * @brief executes the stored group or scene in the background and warns about sockets that
+     * did not reach their states.
+     */
+    auto run_reconciliation_task(const QString &title,
+        std::function<std::vector<sokketter::socket_reconciliation>()> work) -> void;
+
+    auto repopulate_device_list() -> void;
     auto repopulate_socket_list() -> void;
-    auto redraw_socket_list() -> void;
 
     auto repopulate_configure_list() -> void;
     auto redraw_configure_list() -> void;
     auto save_new_configuration() -> void;
     auto forget_selected_device() -> void;
 
-    auto populate_authentication_page(PowerStripListItem *item) -> void;
+    auto populate_authentication_page() -> void;
     auto initialize_settings_page() -> void;
     auto initialize_about_page() -> void;
 
@@ -12,17 +12,17 @@
 #include <QStyleHints>
 
 const QString base_theme = R"(
-    QListWidget {
+    QListWidget, HoverableListView {
         outline: none;
         background: transparent;
     }
 
-    QListWidget::item {
+    QListWidget::item, HoverableListView::item {
         border: none;
         border-radius: 8px;
     }
 
-    QListWidget::item:selected {
+    QListWidget::item:selected, HoverableListView::item:selected {
         background: transparent;
         color: black;
     }
@@ -74,11 +74,15 @@ const QString light_theme = base_theme + R"(
         background-color: #F0F0EE;
     }
 
-    HoverableListWidget::item:enabled:hover {
+    HoverableListView {
+        color: #21201C;
+    }
+
+    HoverableListView::item:enabled:hover {
         background-color: #F1F0EF;
     }
 
-    HoverableListWidget::item:selected {
+    HoverableListView::item:selected {
         background-color: #E9E8E6;
     }
 
@@ -313,11 +317,15 @@ const QString dark_theme = base_theme + R"(
         background-color: #21211F;
     }
 
-    HoverableListWidget::item:enabled:hover {
+    HoverableListView {
+        color: #EEEEEC;
+    }
+
+    HoverableListView::item:enabled:hover {
         background-color: #222325;
     }
 
-    HoverableListWidget::item:selected {
+    HoverableListView::item:selected {
         background-color: #292A2E;
     }
 